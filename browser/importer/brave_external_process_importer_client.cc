@@ -115,3 +115,25 @@ void BraveExternalProcessImporterClient::OnCreditCardImportReady(
                                     decrypted_card_number,
                                     origin);
 }
+
+void BraveExternalProcessImporterClient::OnHistoryImportBatch(
+    const std::vector<ImporterURLRow>& rows,
+    int visit_source,
+    OnHistoryImportBatchCallback callback) {
+  if (!cancelled_) {
+    bridge_->SetHistoryItems(rows,
+        static_cast<importer::VisitSource>(visit_source));
+  }
+
+  std::move(callback).Run();
+}
+
+void BraveExternalProcessImporterClient::OnFaviconsImportBatch(
+    const favicon_base::FaviconUsageDataList& favicons,
+    OnFaviconsImportBatchCallback callback) {
+  if (!cancelled_) {
+    bridge_->SetFavicons(favicons);
+  }
+
+  std::move(callback).Run();
+}
@@ -7,6 +7,7 @@
 #define BRAVE_BROWSER_IMPORTER_BRAVE_EXTERNAL_PROCESS_IMPORTER_CLIENT_H_
 
 #include <string>
+#include <vector>
 
 #include "base/memory/weak_ptr.h"
 #include "base/strings/string16.h"
@@ -43,6 +44,13 @@ class BraveExternalProcessImporterClient
       const base::string16& expiration_year,
       const base::string16& decrypted_card_number,
       const std::string& origin) override;
+  void OnHistoryImportBatch(
+      const std::vector<ImporterURLRow>& rows,
+      int visit_source,
+      OnHistoryImportBatchCallback callback) override;
+  void OnFaviconsImportBatch(
+      const favicon_base::FaviconUsageDataList& favicons,
+      OnFaviconsImportBatchCallback callback) override;
 
  protected:
   ~BraveExternalProcessImporterClient() override;
@@ -72,6 +72,8 @@ void AdsService::RegisterProfilePrefs(
       ads::prefs::kCatalogPing, 0);
   registry->RegisterInt64Pref(
       ads::prefs::kCatalogLastUpdated, 0);
+  registry->RegisterStringPref(
+      ads::prefs::kCatalogCampaignHashes, "");
 
   registry->RegisterStringPref(
       ads::prefs::kEpsilonGreedyBanditArms, "");
@@ -27,6 +27,7 @@
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task_runner_util.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "base/time/time.h"
 #include "base/i18n/time_formatting.h"
 #include "bat/ads/ad_history_info.h"
@@ -35,7 +36,6 @@
 #include "bat/ads/ad_notification_info.h"
 #include "bat/ads/mojom.h"
 #include "bat/ads/pref_names.h"
-#include "bat/ads/resources/grit/bat_ads_resources.h"
 #include "bat/ads/statement_info.h"
 #include "brave/browser/brave_ads/notifications/platform_bridge.h"
 #include "brave/browser/profiles/profile_util.h"
@@ -80,7 +80,6 @@
 #include "services/network/public/cpp/simple_url_loader.h"
 #include "third_party/dom_distiller_js/dom_distiller.pb.h"
 #include "ui/base/l10n/l10n_util.h"
-#include "ui/base/resource/resource_bundle.h"
 
 #if defined(OS_ANDROID)
 #include "chrome/browser/android/service_tab_launcher.h"
@@ -97,25 +96,40 @@ namespace {
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
-}  // namespace
-
-namespace {
-
-static std::map<std::string, int> g_schema_resource_ids = {
-  {ads::g_catalog_schema_resource_id, IDR_ADS_CATALOG_SCHEMA}
+// Preferences which are mirrored in the bat ads utility process so that the
+// ads library can read them without a synchronous round trip
+const char* const kMirroredPrefs[] = {
+  ads::prefs::kEnabled,
+  ads::prefs::kShouldAllowConversionTracking,
+  ads::prefs::kAdsPerHour,
+  ads::prefs::kIdleThreshold,
+  ads::prefs::kShouldAllowAdsSubdivisionTargeting,
+  ads::prefs::kAdsSubdivisionTargetingCode,
+  ads::prefs::kAutoDetectedAdsSubdivisionTargetingCode,
+  ads::prefs::kCatalogId,
+  ads::prefs::kCatalogVersion,
+  ads::prefs::kCatalogPing,
+  ads::prefs::kCatalogLastUpdated,
+  ads::prefs::kCatalogCampaignHashes,
+  ads::prefs::kEpsilonGreedyBanditArms,
+  ads::prefs::kEpsilonGreedyBanditEligibleSegments
 };
 
-int GetSchemaResourceId(
-    const std::string& name) {
-  if (g_schema_resource_ids.find(name) != g_schema_resource_ids.end()) {
-    return g_schema_resource_ids[name];
+bool IsMirroredPref(
+    const std::string& path) {
+  for (const char* mirrored_pref : kMirroredPrefs) {
+    if (path == mirrored_pref) {
+      return true;
+    }
   }
 
-  NOTREACHED();
-
-  return 0;
+  return false;
 }
 
+}  // namespace
+
+namespace {
+
 std::string URLMethodToRequestType(
     ads::UrlRequestMethod method) {
   switch (method) {
@@ -544,6 +558,9 @@ void AdsServiceImpl::Shutdown() {
 
   idle_poll_timer_.Stop();
 
+  pending_db_transactions_.clear();
+  pending_db_transaction_callbacks_.clear();
+
   bat_ads_.reset();
   bat_ads_client_receiver_.reset();
   bat_ads_service_.reset();
@@ -624,11 +641,10 @@ void AdsServiceImpl::OnMigrateConfirmationsState(
 void AdsServiceImpl::Initialize() {
   profile_pref_change_registrar_.Init(profile_->GetPrefs());
 
-  profile_pref_change_registrar_.Add(ads::prefs::kEnabled,
-      base::Bind(&AdsServiceImpl::OnPrefsChanged, base::Unretained(this)));
-
-  profile_pref_change_registrar_.Add(ads::prefs::kIdleThreshold,
-      base::Bind(&AdsServiceImpl::OnPrefsChanged, base::Unretained(this)));
+  for (const char* mirrored_pref : kMirroredPrefs) {
+    profile_pref_change_registrar_.Add(mirrored_pref,
+        base::Bind(&AdsServiceImpl::OnPrefsChanged, base::Unretained(this)));
+  }
 
   profile_pref_change_registrar_.Add(brave_rewards::prefs::kWalletBrave,
       base::Bind(&AdsServiceImpl::OnPrefsChanged, base::Unretained(this)));
@@ -836,9 +852,11 @@ void AdsServiceImpl::OnEnsureBaseDirectoryExists(
   database_ = std::make_unique<ads::Database>(
       base_path_.AppendASCII("database.sqlite"));
 
+  base::flat_map<std::string, base::Value> prefs = GetMirroredPrefs();
+
   bat_ads_service_->Create(
       bat_ads_client_receiver_.BindNewEndpointAndPassRemote(),
-      bat_ads_.BindNewEndpointAndPassReceiver(),
+      bat_ads_.BindNewEndpointAndPassReceiver(), std::move(prefs),
       base::BindOnce(&AdsServiceImpl::OnCreate, AsWeakPtr()));
 
   OnWalletUpdated();
@@ -1636,6 +1654,10 @@ bool AdsServiceImpl::PrefExists(
 
 void AdsServiceImpl::OnPrefsChanged(
     const std::string& pref) {
+  if (IsMirroredPref(pref)) {
+    NotifyMirroredPrefChanged(pref);
+  }
+
   if (pref == ads::prefs::kEnabled) {
     rewards_service_->OnAdsEnabled(IsEnabled());
 
@@ -1660,6 +1682,37 @@ void AdsServiceImpl::OnPrefsChanged(
   }
 }
 
+base::flat_map<std::string, base::Value>
+AdsServiceImpl::GetMirroredPrefs() const {
+  base::flat_map<std::string, base::Value> prefs;
+
+  for (const char* mirrored_pref : kMirroredPrefs) {
+    const base::Value* value =
+        prefs::GetValue(profile_->GetPrefs(), mirrored_pref);
+    if (!value) {
+      continue;
+    }
+
+    prefs[mirrored_pref] = value->Clone();
+  }
+
+  return prefs;
+}
+
+void AdsServiceImpl::NotifyMirroredPrefChanged(
+    const std::string& path) {
+  if (!connected()) {
+    return;
+  }
+
+  const base::Value* value = prefs::GetValue(profile_->GetPrefs(), path);
+  if (!value) {
+    return;
+  }
+
+  bat_ads_->OnPrefChanged(path, value->Clone());
+}
+
 bool AdsServiceImpl::connected() {
   return bat_ads_.is_bound() && !g_browser_process->IsShuttingDown();
 }
@@ -1683,20 +1736,6 @@ std::string AdsServiceImpl::GetLocale() const {
   return brave_l10n::LocaleHelper::GetInstance()->GetLocale();
 }
 
-std::string AdsServiceImpl::LoadDataResourceAndDecompressIfNeeded(
-    const int id) const {
-  std::string data_resource;
-
-  auto& resource_bundle = ui::ResourceBundle::GetSharedInstance();
-  if (resource_bundle.IsGzipped(id)) {
-    data_resource = resource_bundle.LoadDataResourceString(id);
-  } else {
-    data_resource = resource_bundle.GetRawDataResource(id).as_string();
-  }
-
-  return data_resource;
-}
-
 void AdsServiceImpl::ShowNotification(
     const ads::AdNotificationInfo& ad_notification) {
   auto notification = CreateAdNotification(ad_notification);
@@ -1862,42 +1901,68 @@ void AdsServiceImpl::Load(
           AsWeakPtr(), std::move(callback)));
 }
 
-std::string AdsServiceImpl::LoadResourceForId(
-    const std::string& id) {
-  const auto resource_id = GetSchemaResourceId(id);
-  return LoadDataResourceAndDecompressIfNeeded(resource_id);
-}
-
-ads::DBCommandResponsePtr RunDBTransactionOnFileTaskRunner(
-    ads::DBTransactionPtr transaction,
+std::vector<ads::DBCommandResponsePtr> RunDBTransactionsOnFileTaskRunner(
+    std::vector<ads::DBTransactionPtr> transactions,
     ads::Database* database) {
   DCHECK(database);
 
-  auto response = ads::DBCommandResponse::New();
+  std::vector<ads::DBCommandResponsePtr> responses;
 
   if (!database) {
-    response->status = ads::DBCommandResponse::Status::RESPONSE_ERROR;
+    for (size_t i = 0; i < transactions.size(); i++) {
+      auto response = ads::DBCommandResponse::New();
+      response->status = ads::DBCommandResponse::Status::RESPONSE_ERROR;
+      responses.push_back(std::move(response));
+    }
   } else {
-    database->RunTransaction(std::move(transaction), response.get());
+    database->RunTransactions(std::move(transactions), &responses);
   }
 
-  return response;
+  return responses;
 }
 
 void AdsServiceImpl::RunDBTransaction(
     ads::DBTransactionPtr transaction,
     ads::RunDBTransactionCallback callback) {
+  const bool should_post_task = pending_db_transactions_.empty();
+
+  pending_db_transactions_.push_back(std::move(transaction));
+  pending_db_transaction_callbacks_.push_back(std::move(callback));
+
+  if (!should_post_task) {
+    return;
+  }
+
+  base::SequencedTaskRunnerHandle::Get()->PostTask(FROM_HERE,
+      base::BindOnce(&AdsServiceImpl::RunPendingDBTransactions, AsWeakPtr()));
+}
+
+void AdsServiceImpl::RunPendingDBTransactions() {
+  if (pending_db_transactions_.empty()) {
+    return;
+  }
+
+  std::vector<ads::DBTransactionPtr> transactions;
+  transactions.swap(pending_db_transactions_);
+
+  std::vector<ads::RunDBTransactionCallback> callbacks;
+  callbacks.swap(pending_db_transaction_callbacks_);
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&RunDBTransactionOnFileTaskRunner,
-          base::Passed(std::move(transaction)), database_.get()),
-      base::BindOnce(&AdsServiceImpl::OnRunDBTransaction, AsWeakPtr(),
-          std::move(callback)));
+      base::BindOnce(&RunDBTransactionsOnFileTaskRunner,
+          std::move(transactions), database_.get()),
+      base::BindOnce(&AdsServiceImpl::OnRunDBTransactions, AsWeakPtr(),
+          std::move(callbacks)));
 }
 
-void AdsServiceImpl::OnRunDBTransaction(
-    ads::RunDBTransactionCallback callback,
-    ads::DBCommandResponsePtr response) {
-  callback(std::move(response));
+void AdsServiceImpl::OnRunDBTransactions(
+    std::vector<ads::RunDBTransactionCallback> callbacks,
+    std::vector<ads::DBCommandResponsePtr> responses) {
+  DCHECK_EQ(callbacks.size(), responses.size());
+
+  for (size_t i = 0; i < callbacks.size(); i++) {
+    callbacks.at(i)(std::move(responses.at(i)));
+  }
 }
 
 void AdsServiceImpl::OnAdRewardsChanged() {
@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
@@ -305,9 +306,10 @@ class AdsServiceImpl : public AdsService,
       const ads::ResultCallback& callback,
       const bool success);
 
-  void OnRunDBTransaction(
-      ads::RunDBTransactionCallback callback,
-      ads::DBCommandResponsePtr response);
+  void RunPendingDBTransactions();
+  void OnRunDBTransactions(
+      std::vector<ads::RunDBTransactionCallback> callbacks,
+      std::vector<ads::DBCommandResponsePtr> responses);
 
   void MigratePrefs();
   bool MigratePrefs(
@@ -341,10 +343,11 @@ class AdsServiceImpl : public AdsService,
   void OnPrefsChanged(
       const std::string& pref);
 
-  std::string GetLocale() const;
+  base::flat_map<std::string, base::Value> GetMirroredPrefs() const;
+  void NotifyMirroredPrefChanged(
+      const std::string& path);
 
-  std::string LoadDataResourceAndDecompressIfNeeded(
-      const int id) const;
+  std::string GetLocale() const;
 
   void StartNotificationTimeoutTimer(
       const std::string& uuid);
@@ -383,9 +386,6 @@ class AdsServiceImpl : public AdsService,
       const std::string& id,
       ads::LoadCallback callback) override;
 
-  std::string LoadResourceForId(
-      const std::string& id) override;
-
   void RunDBTransaction(
       ads::DBTransactionPtr transaction,
       ads::RunDBTransactionCallback callback) override;
@@ -479,6 +479,11 @@ class AdsServiceImpl : public AdsService,
 
   std::unique_ptr<ads::Database> database_;
 
+  // Transactions requested during the same task are run together with a
+  // single commit
+  std::vector<ads::DBTransactionPtr> pending_db_transactions_;
+  std::vector<ads::RunDBTransactionCallback> pending_db_transaction_callbacks_;
+
   ui::IdleState last_idle_state_;
 
   base::RepeatingTimer idle_poll_timer_;
@@ -6,8 +6,11 @@
 #include "brave/components/brave_ads/browser/ads_tab_helper.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
 #include "chrome/browser/profiles/profile.h"
@@ -27,6 +30,64 @@
 
 namespace brave_ads {
 
+namespace {
+
+// Text classification only needs a representative sample of the page, so cap
+// the amount of text extracted in the renderer rather than shipping the whole
+// of |document.body.innerText| across processes for every navigation
+const size_t kMaxPageTextLength = 32 * 1024;
+
+// Walks text nodes in the renderer and, if the page has more text than
+// |max_length|, samples every Nth node so that the extracted text is spread
+// across the whole document rather than just the top of the page
+std::string GetPageTextScript(
+    const size_t max_length) {
+  return R"(
+      (function(max_length) {
+        if (!document.body) {
+          return '';
+        }
+
+        const ignored_tags = new Set(['SCRIPT', 'STYLE', 'NOSCRIPT',
+            'TEMPLATE']);
+
+        const walker = document.createTreeWalker(document.body,
+            NodeFilter.SHOW_TEXT, {
+              acceptNode: (node) => {
+                return node.parentNode &&
+                    ignored_tags.has(node.parentNode.nodeName) ?
+                        NodeFilter.FILTER_REJECT : NodeFilter.FILTER_ACCEPT;
+              }
+            });
+
+        const nodes = [];
+        let length = 0;
+        while (walker.nextNode()) {
+          const text = walker.currentNode.nodeValue.trim();
+          if (!text) {
+            continue;
+          }
+
+          nodes.push(text);
+          length += text.length + 1;
+        }
+
+        const stride = Math.max(1, Math.ceil(length / max_length));
+
+        const samples = [];
+        let sampled_length = 0;
+        for (let i = 0; i < nodes.length && sampled_length < max_length;
+            i += stride) {
+          samples.push(nodes[i]);
+          sampled_length += nodes[i].length + 1;
+        }
+
+        return samples.join(' ').substring(0, max_length);
+      })()" + base::NumberToString(max_length) + ")";
+}
+
+}  // namespace
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       tab_id_(sessions::SessionTabHelper::IdForTab(web_contents)),
@@ -78,7 +139,7 @@ void AdsTabHelper::RunIsolatedJavaScript(
   DCHECK(render_frame_host);
 
   dom_distiller::RunIsolatedJavaScript(render_frame_host,
-      "document.body.innerText",
+      GetPageTextScript(kMaxPageTextLength),
           base::BindOnce(&AdsTabHelper::OnJavaScriptResult,
               weak_factory_.GetWeakPtr()));
 }
@@ -91,6 +152,9 @@ void AdsTabHelper::OnJavaScriptResult(
   std::string content;
   value.GetAsString(&content);
 
+  // Never trust the renderer to have honored the cap
+  base::TruncateUTF8ToByteSize(content, kMaxPageTextLength, &content);
+
   ads_service_->OnPageLoaded(tab_id_, redirect_chain_, content);
 }
 
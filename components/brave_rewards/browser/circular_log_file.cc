@@ -0,0 +1,287 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/circular_log_file.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "base/big_endian.h"
+#include "base/files/file_util.h"
+#include "base/logging.h"
+#include "brave/components/brave_rewards/browser/file_util.h"
+
+namespace brave_rewards {
+
+namespace {
+
+// The header holds the magic, followed by the write cursor and a flag which
+// is set once the cursor has wrapped around
+const char kMagic[] = "BRLOG001";
+const size_t kMagicSize = sizeof(kMagic) - 1;
+const int64_t kCursorOffset = kMagicSize;
+const int64_t kIsFullOffset = kCursorOffset + sizeof(uint64_t);
+const int64_t kHeaderSize = 32;
+
+const int64_t kChunkSize = 4096;
+
+const size_t kDividerLength = 80;
+
+}  // namespace
+
+CircularLogFile::CircularLogFile(
+    const base::FilePath& path,
+    const int64_t max_file_size)
+    : path_(path),
+      capacity_(max_file_size - kHeaderSize) {
+  DCHECK_GT(capacity_, 0);
+}
+
+CircularLogFile::~CircularLogFile() = default;
+
+bool CircularLogFile::Write(
+    const std::vector<std::string>& log_entries) {
+  if (!Initialize()) {
+    return false;
+  }
+
+  std::string data;
+  for (const auto& log_entry : log_entries) {
+    data += log_entry;
+  }
+
+  return Append(data);
+}
+
+bool CircularLogFile::Read(
+    const int num_lines,
+    std::string* value) {
+  DCHECK(value);
+
+  value->clear();
+
+  if (!base::PathExists(path_)) {
+    return true;
+  }
+
+  if (!Initialize()) {
+    return false;
+  }
+
+  // Chunks are read newest first, walking backwards from the write cursor
+  std::vector<std::string> chunks;
+
+  bool found = false;
+  int line_count = 0;
+
+  int64_t end = is_full_ ? capacity_ : cursor_;
+  while (end > 0 && !found) {
+    const int64_t start = std::max<int64_t>(0, end - kChunkSize);
+
+    std::string chunk(end - start, '\0');
+    if (!ReadAt(start, end - start, &chunk[0])) {
+      return false;
+    }
+
+    if (num_lines != -1) {
+      for (int64_t i = chunk.size() - 1; i >= 0; i--) {
+        if (chunk[i] != '\n') {
+          continue;
+        }
+
+        line_count++;
+        if (line_count == num_lines + 1) {
+          chunk.erase(0, i + 1);
+          found = true;
+          break;
+        }
+      }
+    }
+
+    chunks.push_back(std::move(chunk));
+    end = start;
+  }
+
+  if (!found && is_full_ && !chunks.empty()) {
+    // The oldest line was partially overwritten
+    std::string& oldest_chunk = chunks.back();
+    const size_t pos = oldest_chunk.find('\n');
+    oldest_chunk.erase(0, pos == std::string::npos ? pos : pos + 1);
+  }
+
+  for (auto iter = chunks.rbegin(); iter != chunks.rend(); ++iter) {
+    value->append(*iter);
+  }
+
+  return true;
+}
+
+void CircularLogFile::Close() {
+  file_.Close();
+}
+
+bool CircularLogFile::Delete() {
+  file_.Close();
+
+  if (!base::PathExists(path_)) {
+    return true;
+  }
+
+  return base::DeleteFile(path_);
+}
+
+std::string CircularLogFile::GetLastError() {
+  return GetLastFileError(&file_);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool CircularLogFile::Initialize() {
+  if (!base::PathExists(path_)) {
+    file_.Close();
+    return Create();
+  }
+
+  if (file_.IsValid()) {
+    return true;
+  }
+
+  file_.Initialize(path_, base::File::FLAG_OPEN | base::File::FLAG_READ |
+      base::File::FLAG_WRITE);
+  if (!file_.IsValid()) {
+    return false;
+  }
+
+  if (!ReadHeader()) {
+    // The file was written by an older version or is corrupted, so start a
+    // new log
+    file_.Close();
+    return Create();
+  }
+
+  std::string divider = std::string(kDividerLength, '-');
+  divider += "\n";
+
+  return Append(divider);
+}
+
+bool CircularLogFile::Create() {
+  file_.Initialize(path_, base::File::FLAG_CREATE_ALWAYS |
+      base::File::FLAG_READ | base::File::FLAG_WRITE);
+  if (!file_.IsValid()) {
+    return false;
+  }
+
+  if (!file_.SetLength(kHeaderSize + capacity_)) {
+    return false;
+  }
+
+  cursor_ = 0;
+  is_full_ = false;
+
+  return WriteHeader();
+}
+
+bool CircularLogFile::ReadHeader() {
+  if (file_.GetLength() != kHeaderSize + capacity_) {
+    return false;
+  }
+
+  char header[kHeaderSize];
+  if (file_.Read(0, header, kHeaderSize) != kHeaderSize) {
+    return false;
+  }
+
+  if (memcmp(header, kMagic, kMagicSize) != 0) {
+    return false;
+  }
+
+  uint64_t cursor;
+  base::ReadBigEndian(header + kCursorOffset, &cursor);
+  if (cursor >= static_cast<uint64_t>(capacity_)) {
+    return false;
+  }
+
+  cursor_ = cursor;
+  is_full_ = header[kIsFullOffset] != 0;
+
+  return true;
+}
+
+bool CircularLogFile::WriteHeader() {
+  char header[kHeaderSize] = {};
+  memcpy(header, kMagic, kMagicSize);
+  base::WriteBigEndian(header + kCursorOffset,
+      static_cast<uint64_t>(cursor_));
+  header[kIsFullOffset] = is_full_ ? 1 : 0;
+
+  return file_.Write(0, header, kHeaderSize) == kHeaderSize;
+}
+
+bool CircularLogFile::Append(
+    const std::string& data) {
+  const char* buffer = data.data();
+  int64_t size = data.size();
+
+  if (size == 0) {
+    return true;
+  }
+
+  // Only the newest data fits if more than the capacity is written
+  if (size > capacity_) {
+    buffer += size - capacity_;
+    size = capacity_;
+  }
+
+  const int64_t size_to_end = std::min(size, capacity_ - cursor_);
+  if (file_.Write(kHeaderSize + cursor_, buffer, size_to_end) !=
+      size_to_end) {
+    return false;
+  }
+
+  const int64_t size_from_start = size - size_to_end;
+  if (size_from_start > 0 && file_.Write(kHeaderSize,
+      buffer + size_to_end, size_from_start) != size_from_start) {
+    return false;
+  }
+
+  cursor_ += size;
+  if (cursor_ >= capacity_) {
+    cursor_ -= capacity_;
+    is_full_ = true;
+  }
+
+  return WriteHeader();
+}
+
+bool CircularLogFile::ReadAt(
+    const int64_t offset,
+    const int64_t size,
+    char* data) {
+  DCHECK(data);
+
+  // |offset| is relative to the oldest byte in the log
+  int64_t position = offset;
+  if (is_full_) {
+    position = (cursor_ + offset) % capacity_;
+  }
+
+  const int64_t size_to_end = std::min(size, capacity_ - position);
+  if (file_.Read(kHeaderSize + position, data, size_to_end) != size_to_end) {
+    return false;
+  }
+
+  const int64_t size_from_start = size - size_to_end;
+  if (size_from_start > 0 && file_.Read(kHeaderSize,
+      data + size_to_end, size_from_start) != size_from_start) {
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace brave_rewards
@@ -0,0 +1,78 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_CIRCULAR_LOG_FILE_H_
+#define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_CIRCULAR_LOG_FILE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+
+namespace brave_rewards {
+
+// Stores log entries in a preallocated file of a fixed size which is written
+// as a circular buffer, so that the file never needs to be truncated. A small
+// header at the start of the file holds the write cursor. Must only be used
+// on a sequence which allows blocking
+class CircularLogFile {
+ public:
+  CircularLogFile(
+      const base::FilePath& path,
+      const int64_t max_file_size);
+
+  ~CircularLogFile();
+
+  CircularLogFile(const CircularLogFile&) = delete;
+  CircularLogFile& operator=(const CircularLogFile&) = delete;
+
+  // Appends |log_entries|, each of which should be terminated by a newline.
+  // The oldest entries are overwritten once the file is full
+  bool Write(
+      const std::vector<std::string>& log_entries);
+
+  // Reads the last |num_lines| lines, or every line if |num_lines| is -1, by
+  // walking backwards from the write cursor
+  bool Read(
+      const int num_lines,
+      std::string* value);
+
+  // Closes the file. It is reopened by the next read or write
+  void Close();
+
+  // Closes and deletes the file
+  bool Delete();
+
+  std::string GetLastError();
+
+ private:
+  bool Initialize();
+  bool Create();
+
+  bool ReadHeader();
+  bool WriteHeader();
+
+  bool Append(
+      const std::string& data);
+
+  bool ReadAt(
+      const int64_t offset,
+      const int64_t size,
+      char* data);
+
+  const base::FilePath path_;
+  const int64_t capacity_;
+
+  base::File file_;
+  int64_t cursor_ = 0;
+  bool is_full_ = false;
+};
+
+}  // namespace brave_rewards
+
+#endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_CIRCULAR_LOG_FILE_H_
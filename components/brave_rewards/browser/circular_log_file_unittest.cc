@@ -0,0 +1,119 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_rewards/browser/circular_log_file.h"
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=CircularLogFileTest.*
+
+namespace brave_rewards {
+
+class CircularLogFileTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().AppendASCII("Rewards.log");
+  }
+
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+};
+
+TEST_F(CircularLogFileTest, ReadMissingFile) {
+  CircularLogFile log(path_, 1024);
+
+  std::string value = "value";
+  EXPECT_TRUE(log.Read(-1, &value));
+  EXPECT_EQ(value, "");
+}
+
+TEST_F(CircularLogFileTest, PreallocatesFile) {
+  CircularLogFile log(path_, 1024);
+  ASSERT_TRUE(log.Write({"1\n"}));
+
+  int64_t size = 0;
+  ASSERT_TRUE(base::GetFileSize(path_, &size));
+  EXPECT_EQ(size, 1024);
+}
+
+TEST_F(CircularLogFileTest, ReadLastLines) {
+  CircularLogFile log(path_, 1024);
+  ASSERT_TRUE(log.Write({"1\n", "2\n", "3\n"}));
+
+  std::string value;
+  ASSERT_TRUE(log.Read(2, &value));
+  EXPECT_EQ(value, "2\n3\n");
+
+  ASSERT_TRUE(log.Read(-1, &value));
+  EXPECT_EQ(value, "1\n2\n3\n");
+
+  ASSERT_TRUE(log.Read(0, &value));
+  EXPECT_EQ(value, "");
+}
+
+TEST_F(CircularLogFileTest, WrapAround) {
+  // 64 bytes of data after the 32 byte header
+  CircularLogFile log(path_, 96);
+
+  std::vector<std::string> log_entries;
+  for (int i = 0; i < 30; i++) {
+    log_entries.push_back(std::to_string(i) + "abcdef\n");
+  }
+  ASSERT_TRUE(log.Write(log_entries));
+
+  int64_t size = 0;
+  ASSERT_TRUE(base::GetFileSize(path_, &size));
+  EXPECT_EQ(size, 96);
+
+  std::string value;
+  ASSERT_TRUE(log.Read(2, &value));
+  EXPECT_EQ(value, "28abcdef\n29abcdef\n");
+
+  // The partially overwritten oldest line is dropped
+  ASSERT_TRUE(log.Read(-1, &value));
+  EXPECT_EQ(value, "23abcdef\n24abcdef\n25abcdef\n26abcdef\n27abcdef\n"
+      "28abcdef\n29abcdef\n");
+}
+
+TEST_F(CircularLogFileTest, Reopen) {
+  {
+    CircularLogFile log(path_, 1024);
+    ASSERT_TRUE(log.Write({"1\n", "2\n"}));
+  }
+
+  CircularLogFile log(path_, 1024);
+  ASSERT_TRUE(log.Write({"3\n"}));
+
+  std::string value;
+  ASSERT_TRUE(log.Read(-1, &value));
+  EXPECT_EQ(value, "1\n2\n" + std::string(80, '-') + "\n3\n");
+}
+
+TEST_F(CircularLogFileTest, ReplacesLegacyFile) {
+  ASSERT_TRUE(base::WriteFile(path_, "legacy\n"));
+
+  CircularLogFile log(path_, 1024);
+  ASSERT_TRUE(log.Write({"1\n"}));
+
+  std::string value;
+  ASSERT_TRUE(log.Read(-1, &value));
+  EXPECT_EQ(value, "1\n");
+}
+
+TEST_F(CircularLogFileTest, Delete) {
+  CircularLogFile log(path_, 1024);
+  ASSERT_TRUE(log.Write({"1\n"}));
+
+  EXPECT_TRUE(log.Delete());
+  EXPECT_FALSE(base::PathExists(path_));
+}
+
+}  // namespace brave_rewards
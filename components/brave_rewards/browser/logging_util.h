@@ -8,15 +8,10 @@
 
 #include <string>
 
-#include "base/files/file_util.h"
 #include "base/time/time.h"
 
 namespace brave_rewards {
 
-bool InitializeLog(
-    base::File* file,
-    const base::FilePath& path);
-
 std::string FriendlyFormatLogEntry(
     const base::Time& time,
     const std::string& file,
@@ -24,10 +19,6 @@ std::string FriendlyFormatLogEntry(
     const int verbose_level,
     const std::string& message);
 
-bool WriteToLog(
-    base::File* file,
-    const std::string& log_entry);
-
 }  // namespace brave_rewards
 
 #endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LOGGING_UTIL_H_
@@ -32,6 +32,7 @@
 #include "base/task_runner_util.h"
 #include "base/threading/sequenced_task_runner_handle.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "bat/ads/pref_names.h"
 #include "bat/ledger/global_constants.h"
 #include "bat/ledger/ledger_database.h"
@@ -41,7 +42,7 @@
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
 #include "brave/components/brave_ads/browser/buildflags/buildflags.h"
 #include "brave/components/brave_rewards/browser/android_util.h"
-#include "brave/components/brave_rewards/browser/file_util.h"
+#include "brave/components/brave_rewards/browser/circular_log_file.h"
 #include "brave/components/brave_rewards/browser/logging.h"
 #include "brave/components/brave_rewards/browser/logging_util.h"
 #include "brave/components/brave_rewards/browser/rewards_notification_service.h"
@@ -73,6 +74,7 @@
 #include "net/http/http_status_code.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
+#include "sql/database.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/gfx/image/image.h"
 #include "url/gurl.h"
@@ -101,8 +103,9 @@ static const unsigned int kRetriesCountOnNetworkChange = 1;
 namespace {
 
 const int kDiagnosticLogMaxVerboseLevel = 6;
-const int kTailDiagnosticLogToNumLines = 20000;
 const int kDiagnosticLogMaxFileSize = 10 * (1024 * 1024);
+const size_t kDiagnosticLogMaxPendingEntries = 500;
+const int kDiagnosticLogFlushDelayInSeconds = 5;
 const char pref_prefix[] = "brave.rewards";
 
 std::string URLMethodToRequestType(ledger::type::UrlMethod method) {
@@ -265,6 +268,121 @@ std::string GetPrefPath(const std::string& name) {
   return base::StringPrintf("%s.%s", pref_prefix, name.c_str());
 }
 
+// Prefs backing ledger state which are mirrored in the ledger process so that
+// state can be read without a synchronous round trip to the browser process
+const char* const kMirroredStatePrefs[] = {
+  prefs::kEnabled,
+  prefs::kServerPublisherListStamp,
+  prefs::kUpholdAnonAddress,
+  prefs::kPromotionLastFetchStamp,
+  prefs::kPromotionCorruptedMigrated,
+  prefs::kAnonTransferChecked,
+  prefs::kVersion,
+  prefs::kMinVisitTime,
+  prefs::kMinVisits,
+  prefs::kAllowNonVerified,
+  prefs::kAllowVideoContribution,
+  prefs::kScoreA,
+  prefs::kScoreB,
+  prefs::kAutoContributeEnabled,
+  prefs::kAutoContributeAmount,
+  prefs::kNextReconcileStamp,
+  prefs::kCreationStamp,
+  prefs::kRecoverySeed,
+  prefs::kPaymentId,
+  prefs::kInlineTipRedditEnabled,
+  prefs::kInlineTipTwitterEnabled,
+  prefs::kInlineTipGithubEnabled,
+  prefs::kParametersRate,
+  prefs::kParametersAutoContributeChoice,
+  prefs::kParametersAutoContributeChoices,
+  prefs::kParametersTipChoices,
+  prefs::kParametersMonthlyTipChoices,
+  prefs::kFetchOldBalance,
+  prefs::kEmptyBalanceChecked,
+  prefs::kWalletBrave,
+  prefs::kWalletUphold
+};
+
+std::string GetStateName(const std::string& path) {
+  const std::string prefix = base::StringPrintf("%s.", pref_prefix);
+  DCHECK(base::StartsWith(path, prefix, base::CompareCase::SENSITIVE));
+  return path.substr(prefix.length());
+}
+
+bool IsMirroredStatePref(const std::string& path) {
+  for (const char* mirrored_pref : kMirroredStatePrefs) {
+    if (path == mirrored_pref) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+base::flat_map<std::string, base::Value> GetOptions() {
+  base::flat_map<std::string, base::Value> options;
+
+  for (const auto& option : kBoolOptions) {
+    options[option.first] = base::Value(option.second);
+  }
+
+  for (const auto& option : kIntegerOptions) {
+    options[option.first] = base::Value(option.second);
+  }
+
+  for (const auto& option : kDoubleOptions) {
+    options[option.first] = base::Value(option.second);
+  }
+
+  for (const auto& option : kStringOptions) {
+    options[option.first] = base::Value(option.second);
+  }
+
+  // 64-bit integers are serialized as strings, matching |PrefService|
+  for (const auto& option : kInt64Options) {
+    options[option.first] = base::Value(base::NumberToString(option.second));
+  }
+
+  for (const auto& option : kUInt64Options) {
+    options[option.first] = base::Value(base::NumberToString(option.second));
+  }
+
+  return options;
+}
+
+// File tasks are bound to the log rather than to |RewardsServiceImpl|, which
+// may be destroyed before they run. The log itself is deleted on the file task
+// runner after any pending tasks
+bool WriteDiagnosticLogEntries(
+    CircularLogFile* diagnostic_log,
+    const std::vector<std::string>& log_entries) {
+  DCHECK(diagnostic_log);
+
+  if (!diagnostic_log->Write(log_entries)) {
+    VLOG(0) << "Failed to write to diagnostic log: "
+        << diagnostic_log->GetLastError();
+
+    return false;
+  }
+
+  return true;
+}
+
+std::string ReadDiagnosticLog(
+    CircularLogFile* diagnostic_log,
+    const int num_lines) {
+  DCHECK(diagnostic_log);
+
+  std::string value;
+  if (!diagnostic_log->Read(num_lines, &value)) {
+    return base::StringPrintf("ERROR: %s",
+        diagnostic_log->GetLastError().c_str());
+  }
+
+  return value;
+}
+
 }  // namespace
 
 bool IsMediaLink(const GURL& url,
@@ -308,6 +426,8 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
            base::TaskPriority::USER_VISIBLE,
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
       diagnostic_log_path_(profile_->GetPath().Append(kDiagnosticLogPath)),
+      diagnostic_log_(std::make_unique<CircularLogFile>(diagnostic_log_path_,
+          kDiagnosticLogMaxFileSize)),
       ledger_state_path_(profile_->GetPath().Append(kLedger_state)),
       publisher_state_path_(profile_->GetPath().Append(kPublisher_state)),
       publisher_info_db_path_(profile->GetPath().Append(kPublisher_info_db)),
@@ -324,6 +444,7 @@ RewardsServiceImpl::~RewardsServiceImpl() {
   if (ledger_database_) {
     file_task_runner_->DeleteSoon(FROM_HERE, ledger_database_.release());
   }
+  file_task_runner_->DeleteSoon(FROM_HERE, diagnostic_log_.release());
   StopNotificationTimers();
 }
 
@@ -371,29 +492,22 @@ void RewardsServiceImpl::Init(
 
 void RewardsServiceImpl::InitPrefChangeRegistrar() {
   profile_pref_change_registrar_.Init(profile_->GetPrefs());
-  profile_pref_change_registrar_.Add(
-      prefs::kInlineTipTwitterEnabled,
-      base::Bind(
-          &RewardsServiceImpl::OnPreferenceChanged,
-          base::Unretained(this)));
-  profile_pref_change_registrar_.Add(
-      prefs::kInlineTipRedditEnabled,
-      base::Bind(
-          &RewardsServiceImpl::OnPreferenceChanged,
-          base::Unretained(this)));
-  profile_pref_change_registrar_.Add(
-      prefs::kInlineTipGithubEnabled,
-      base::Bind(
-          &RewardsServiceImpl::OnPreferenceChanged,
-          base::Unretained(this)));
-  profile_pref_change_registrar_.Add(
-      prefs::kAutoContributeEnabled,
-      base::Bind(
-          &RewardsServiceImpl::OnPreferenceChanged,
-          base::Unretained(this)));
+
+  // Includes the inline tip and auto contribute prefs
+  for (const char* mirrored_pref : kMirroredStatePrefs) {
+    profile_pref_change_registrar_.Add(
+        mirrored_pref,
+        base::Bind(
+            &RewardsServiceImpl::OnPreferenceChanged,
+            base::Unretained(this)));
+  }
 }
 
 void RewardsServiceImpl::OnPreferenceChanged(const std::string& key) {
+  if (IsMirroredStatePref(key)) {
+    NotifyStateChanged(key);
+  }
+
   if (profile_->GetPrefs()->GetInteger(prefs::kVersion) == -1) {
     return;
   }
@@ -407,6 +521,35 @@ void RewardsServiceImpl::OnPreferenceChanged(const std::string& key) {
   }
 }
 
+base::flat_map<std::string, base::Value>
+RewardsServiceImpl::GetMirroredState() const {
+  base::flat_map<std::string, base::Value> state;
+
+  for (const char* mirrored_pref : kMirroredStatePrefs) {
+    const base::Value* value = profile_->GetPrefs()->Get(mirrored_pref);
+    if (!value) {
+      continue;
+    }
+
+    state[GetStateName(mirrored_pref)] = value->Clone();
+  }
+
+  return state;
+}
+
+void RewardsServiceImpl::NotifyStateChanged(const std::string& path) {
+  if (!Connected()) {
+    return;
+  }
+
+  const base::Value* value = profile_->GetPrefs()->Get(path);
+  if (!value) {
+    return;
+  }
+
+  bat_ledger_->OnStateChanged(GetStateName(path), value->Clone());
+}
+
 void RewardsServiceImpl::CheckPreferences() {
   const bool is_ac_enabled = profile_->GetPrefs()->GetBoolean(
       brave_rewards::prefs::kAutoContributeEnabled);
@@ -466,6 +609,8 @@ void RewardsServiceImpl::StartLedger(StartProcessCallback callback) {
   bat_ledger_service_->Create(
       bat_ledger_client_receiver_.BindNewEndpointAndPassRemote(),
       bat_ledger_.BindNewEndpointAndPassReceiver(),
+      GetMirroredState(),
+      GetOptions(),
       base::BindOnce(&RewardsServiceImpl::OnCreate,
           AsWeakPtr(),
           std::move(callback)));
@@ -809,6 +954,8 @@ void RewardsServiceImpl::Shutdown() {
   }
   url_loaders_.clear();
 
+  FlushDiagnosticLog();
+
   bat_ledger_.reset();
   RewardsService::Shutdown();
 }
@@ -1379,17 +1526,18 @@ void RewardsServiceImpl::OnStopLedgerForCompleteReset(
 
 bool RewardsServiceImpl::ResetOnFilesTaskRunner() {
   // Close any open files before deleting them (required on Windows)
-  diagnostic_log_.Close();
+  diagnostic_log_->Close();
 
   const std::vector<base::FilePath> paths = {
     ledger_state_path_,
     publisher_state_path_,
-    publisher_info_db_path_,
     diagnostic_log_path_,
     publisher_list_path_,
   };
 
-  bool res = true;
+  // The database is deleted together with its journal and write-ahead log, so
+  // that neither is paired with the database created after the reset
+  bool res = sql::Database::Delete(publisher_info_db_path_);
   for (size_t i = 0; i < paths.size(); i++) {
     if (!base::DeletePathRecursively(paths[i])) {
       res = false;
@@ -2210,32 +2358,6 @@ void RewardsServiceImpl::ShowNotificationTipsPaid(bool ac_enabled) {
       "rewards_notification_tips_processed");
 }
 
-bool RewardsServiceImpl::MaybeTailDiagnosticLog(
-    const int num_lines) {
-  if (!diagnostic_log_.IsValid()) {
-    return false;
-  }
-
-  static bool first_run = true;
-
-  const int64_t length = diagnostic_log_.GetLength();
-  if (length == -1) {
-    return false;
-  }
-
-  if (!first_run && length <= kDiagnosticLogMaxFileSize) {
-    return true;
-  }
-
-  first_run = false;
-
-  if (!TailFile(&diagnostic_log_, num_lines)) {
-    return false;
-  }
-
-  return true;
-}
-
 void RewardsServiceImpl::DiagnosticLog(
     const std::string& file,
     const int line,
@@ -2253,52 +2375,45 @@ void RewardsServiceImpl::DiagnosticLog(
     return;
   }
 
-  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner,
-          base::Unretained(this),
-          diagnostic_log_path_,
-          kTailDiagnosticLogToNumLines,
-          file,
-          line,
-          verbose_level,
-          message),
-      base::BindOnce(&RewardsServiceImpl::OnWriteToLogOnFileTaskRunner,
-          AsWeakPtr()));
-}
-
-bool RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner(
-    const base::FilePath& log_path,
-    const int num_lines,
-    const std::string& file,
-    const int line,
-    const int verbose_level,
-    const std::string& message) {
-  if (!InitializeLog(&diagnostic_log_, log_path)) {
-    VLOG(0) << "Failed to initialize diagnostic log: "
-        << GetLastFileError(&diagnostic_log_);
+  pending_diagnostic_log_entries_.push_back(FriendlyFormatLogEntry(
+      base::Time::Now(), file, line, verbose_level, message));
 
-    return false;
+  if (pending_diagnostic_log_entries_.size() >=
+      kDiagnosticLogMaxPendingEntries) {
+    FlushDiagnosticLog();
+    return;
   }
 
-  const base::Time time = base::Time::Now();
-
-  const std::string log_entry =
-      FriendlyFormatLogEntry(time, file, line, verbose_level, message);
-
-  if (!WriteToLog(&diagnostic_log_, log_entry)) {
-    VLOG(0) << "Failed to write to diagnostic log: "
-        << GetLastFileError(&diagnostic_log_);
+  if (!diagnostic_log_flush_timer_) {
+    diagnostic_log_flush_timer_ = std::make_unique<base::OneShotTimer>();
+  }
 
-    return false;
+  if (!diagnostic_log_flush_timer_->IsRunning()) {
+    diagnostic_log_flush_timer_->Start(FROM_HERE,
+        base::TimeDelta::FromSeconds(kDiagnosticLogFlushDelayInSeconds),
+        base::BindOnce(&RewardsServiceImpl::FlushDiagnosticLog,
+            AsWeakPtr()));
   }
+}
 
-  if (!MaybeTailDiagnosticLog(num_lines)) {
-    VLOG(0) << "Failed to vacuum diagnostic log";
+void RewardsServiceImpl::FlushDiagnosticLog() {
+  if (diagnostic_log_flush_timer_) {
+    diagnostic_log_flush_timer_->Stop();
+  }
 
-    return false;
+  if (pending_diagnostic_log_entries_.empty()) {
+    return;
   }
 
-  return true;
+  std::vector<std::string> log_entries;
+  log_entries.swap(pending_diagnostic_log_entries_);
+
+  base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
+      base::BindOnce(&WriteDiagnosticLogEntries,
+          base::Unretained(diagnostic_log_.get()),
+          std::move(log_entries)),
+      base::BindOnce(&RewardsServiceImpl::OnWriteToLogOnFileTaskRunner,
+          AsWeakPtr()));
 }
 
 void RewardsServiceImpl::OnWriteToLogOnFileTaskRunner(
@@ -2309,32 +2424,19 @@ void RewardsServiceImpl::OnWriteToLogOnFileTaskRunner(
 void RewardsServiceImpl::LoadDiagnosticLog(
       const int num_lines,
       LoadDiagnosticLogCallback callback) {
+  // Pending entries are written before the log is read, as both tasks run on
+  // the same sequence
+  FlushDiagnosticLog();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&RewardsServiceImpl::LoadDiagnosticLogOnFileTaskRunner,
-          base::Unretained(this),
-          diagnostic_log_path_,
+      base::BindOnce(&ReadDiagnosticLog,
+          base::Unretained(diagnostic_log_.get()),
           num_lines),
       base::BindOnce(&RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner,
           AsWeakPtr(),
           std::move(callback)));
 }
 
-std::string RewardsServiceImpl::LoadDiagnosticLogOnFileTaskRunner(
-    const base::FilePath& path,
-    const int num_lines) {
-  if (!base::PathExists(path)) {
-    return "";
-  }
-
-  std::string value;
-  if (!TailFileAsString(&diagnostic_log_, num_lines, &value)) {
-    return base::StringPrintf("ERROR: %s",
-        GetLastFileError(&diagnostic_log_).c_str());
-  }
-
-  return value;
-}
-
 void RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner(
     LoadDiagnosticLogCallback callback,
     const std::string& value) {
@@ -2343,26 +2445,16 @@ void RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner(
 
 void RewardsServiceImpl::ClearDiagnosticLog(
     ClearDiagnosticLogCallback callback) {
+  pending_diagnostic_log_entries_.clear();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
-      base::BindOnce(&RewardsServiceImpl::ClearDiagnosticLogOnFileTaskRunner,
-          base::Unretained(this),
-          diagnostic_log_path_),
+      base::BindOnce(&CircularLogFile::Delete,
+          base::Unretained(diagnostic_log_.get())),
       base::BindOnce(&RewardsServiceImpl::OnClearDiagnosticLogOnFileTaskRunner,
           AsWeakPtr(),
           std::move(callback)));
 }
 
-bool RewardsServiceImpl::ClearDiagnosticLogOnFileTaskRunner(
-    const base::FilePath& path) {
-  if (!base::PathExists(path)) {
-    return true;
-  }
-
-  diagnostic_log_.Close();
-
-  return base::DeleteFile(path);
-}
-
 void RewardsServiceImpl::OnClearDiagnosticLogOnFileTaskRunner(
     ClearDiagnosticLogCallback callback,
     const bool success) {
@@ -3298,6 +3390,7 @@ void RewardsServiceImpl::ClearAllNotifications() {
 
 void RewardsServiceImpl::CompleteReset(SuccessCallback callback) {
   resetting_rewards_ = true;
+  pending_diagnostic_log_entries_.clear();
 
   auto* ads_service = brave_ads::AdsServiceFactory::GetForProfile(profile_);
   if (ads_service) {
@@ -3344,23 +3437,19 @@ void RewardsServiceImpl::WalletDisconnected(const std::string& wallet_type) {
 }
 
 void RewardsServiceImpl::DeleteLog(ledger::ResultCallback callback) {
-  diagnostic_log_.Close();
+  pending_diagnostic_log_entries_.clear();
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
       FROM_HERE,
       base::BindOnce(
-          &RewardsServiceImpl::DeleteLogTaskRunner,
-          base::Unretained(this)),
+          &CircularLogFile::Delete,
+          base::Unretained(diagnostic_log_.get())),
       base::BindOnce(
           &RewardsServiceImpl::OnDeleteLog,
           AsWeakPtr(),
           std::move(callback)));
 }
 
-bool RewardsServiceImpl::DeleteLogTaskRunner() {
-  return base::DeleteFile(diagnostic_log_path_);
-}
-
 void RewardsServiceImpl::OnDeleteLog(
     ledger::ResultCallback callback,
     const bool success) {
@@ -70,6 +70,7 @@ class RewardsFlagBrowserTest;
 
 namespace brave_rewards {
 
+class CircularLogFile;
 class RewardsNotificationServiceImpl;
 class RewardsBrowserTest;
 
@@ -360,6 +361,9 @@ class RewardsServiceImpl : public RewardsService,
 
   void OnPreferenceChanged(const std::string& key);
 
+  base::flat_map<std::string, base::Value> GetMirroredState() const;
+  void NotifyStateChanged(const std::string& path);
+
   void CheckPreferences();
 
   void StartLedger(StartProcessCallback callback);
@@ -575,22 +579,13 @@ class RewardsServiceImpl : public RewardsService,
       SavePublisherInfoCallback callback,
       const ledger::type::Result result);
 
-  bool MaybeTailDiagnosticLog(
-      const int num_lines);
-
   void DiagnosticLog(
       const std::string& file,
       const int line,
       const int verbose_level,
       const std::string& message) override;
 
-  bool WriteToDiagnosticLogOnFileTaskRunner(
-      const base::FilePath& log_path,
-      const int num_lines,
-      const std::string& file,
-      const int line,
-      const int verbose_level,
-      const std::string& message);
+  void FlushDiagnosticLog();
 
   void OnWriteToLogOnFileTaskRunner(
     const bool success);
@@ -599,10 +594,6 @@ class RewardsServiceImpl : public RewardsService,
       const int num_lines,
       LoadDiagnosticLogCallback callback) override;
 
-  std::string LoadDiagnosticLogOnFileTaskRunner(
-      const base::FilePath& path,
-      const int num_lines);
-
   void OnLoadDiagnosticLogOnFileTaskRunner(
       LoadDiagnosticLogCallback callback,
       const std::string& value);
@@ -611,9 +602,6 @@ class RewardsServiceImpl : public RewardsService,
 
   void CompleteReset(SuccessCallback callback) override;
 
-  bool ClearDiagnosticLogOnFileTaskRunner(
-      const base::FilePath& path);
-
   void OnClearDiagnosticLogOnFileTaskRunner(
       ClearDiagnosticLogCallback callback,
       const bool success);
@@ -752,8 +740,6 @@ class RewardsServiceImpl : public RewardsService,
       SuccessCallback callback,
       const ledger::type::Result result);
 
-  bool DeleteLogTaskRunner();
-
   void OnDeleteLog(ledger::ResultCallback callback, const bool success);
 
   void OnGetEventLogs(
@@ -782,7 +768,9 @@ class RewardsServiceImpl : public RewardsService,
   mojo::Remote<bat_ledger::mojom::BatLedgerService> bat_ledger_service_;
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
   const base::FilePath diagnostic_log_path_;
-  base::File diagnostic_log_;
+  std::unique_ptr<CircularLogFile> diagnostic_log_;
+  std::vector<std::string> pending_diagnostic_log_entries_;
+  std::unique_ptr<base::OneShotTimer> diagnostic_log_flush_timer_;
   const base::FilePath ledger_state_path_;
   const base::FilePath publisher_state_path_;
   const base::FilePath publisher_info_db_path_;
@@ -9,9 +9,11 @@
 #include <memory>
 #include <utility>
 
+#include "base/bind.h"
+#include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
 #include "mojo/public/cpp/bindings/interface_request.h"
 #include "mojo/public/cpp/bindings/sync_call_restrictions.h"
-#include "base/logging.h"
 
 namespace bat_ads {
 
@@ -27,12 +29,20 @@ ads::Result ToAdsResult(
 ///////////////////////////////////////////////////////////////////////////////
 
 BatAdsClientMojoBridge::BatAdsClientMojoBridge(
-    mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info) {
+    mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
+    base::flat_map<std::string, base::Value> prefs)
+    : prefs_(std::move(prefs)) {
   bat_ads_client_.Bind(std::move(client_info));
 }
 
 BatAdsClientMojoBridge::~BatAdsClientMojoBridge() = default;
 
+void BatAdsClientMojoBridge::OnPrefChanged(
+    const std::string& path,
+    base::Value value) {
+  prefs_.OnChanged(path, std::move(value));
+}
+
 bool BatAdsClientMojoBridge::IsNetworkConnectionAvailable() const {
   if (!connected()) {
     return false;
@@ -181,18 +191,6 @@ void BatAdsClientMojoBridge::Load(
   bat_ads_client_->Load(name, base::BindOnce(&OnLoad, std::move(callback)));
 }
 
-std::string BatAdsClientMojoBridge::LoadResourceForId(
-    const std::string& id) {
-  std::string value;
-
-  if (!connected()) {
-    return value;
-  }
-
-  bat_ads_client_->LoadResourceForId(id, &value);
-  return value;
-}
-
 void OnRunDBTransaction(
     const ads::RunDBTransactionCallback& callback,
     ads::DBCommandResponsePtr response) {
@@ -228,14 +226,12 @@ void BatAdsClientMojoBridge::Log(
 
 bool BatAdsClientMojoBridge::GetBooleanPref(
     const std::string& path) const {
-  bool value = false;
-
-  if (!connected()) {
-    return value;
+  const base::Value* value = GetPref(path);
+  if (!value || !value->is_bool()) {
+    return false;
   }
 
-  bat_ads_client_->GetBooleanPref(path, &value);
-  return value;
+  return value->GetBool();
 }
 
 void BatAdsClientMojoBridge::SetBooleanPref(
@@ -245,19 +241,21 @@ void BatAdsClientMojoBridge::SetBooleanPref(
     return;
   }
 
-  bat_ads_client_->SetBooleanPref(path, value);
+  SetPref(path, base::Value(value));
+
+  bat_ads_client_->SetBooleanPref(path, value,
+      base::BindOnce(&BatAdsClientMojoBridge::OnSetPref,
+          weak_factory_.GetWeakPtr(), path));
 }
 
 int BatAdsClientMojoBridge::GetIntegerPref(
     const std::string& path) const {
-  int value = 0;
-
-  if (!connected()) {
-    return value;
+  const base::Value* value = GetPref(path);
+  if (!value || !value->is_int()) {
+    return 0;
   }
 
-  bat_ads_client_->GetIntegerPref(path, &value);
-  return value;
+  return value->GetInt();
 }
 
 void BatAdsClientMojoBridge::SetIntegerPref(
@@ -267,19 +265,21 @@ void BatAdsClientMojoBridge::SetIntegerPref(
     return;
   }
 
-  bat_ads_client_->SetIntegerPref(path, value);
+  SetPref(path, base::Value(value));
+
+  bat_ads_client_->SetIntegerPref(path, value,
+      base::BindOnce(&BatAdsClientMojoBridge::OnSetPref,
+          weak_factory_.GetWeakPtr(), path));
 }
 
 double BatAdsClientMojoBridge::GetDoublePref(
     const std::string& path) const {
-  double value = 0.0;
-
-  if (!connected()) {
-    return value;
+  const base::Value* value = GetPref(path);
+  if (!value || !(value->is_double() || value->is_int())) {
+    return 0.0;
   }
 
-  bat_ads_client_->GetDoublePref(path, &value);
-  return value;
+  return value->GetDouble();
 }
 
 void BatAdsClientMojoBridge::SetDoublePref(
@@ -289,19 +289,21 @@ void BatAdsClientMojoBridge::SetDoublePref(
     return;
   }
 
-  bat_ads_client_->SetDoublePref(path, value);
+  SetPref(path, base::Value(value));
+
+  bat_ads_client_->SetDoublePref(path, value,
+      base::BindOnce(&BatAdsClientMojoBridge::OnSetPref,
+          weak_factory_.GetWeakPtr(), path));
 }
 
 std::string BatAdsClientMojoBridge::GetStringPref(
     const std::string& path) const {
-  std::string value;
-
-  if (!connected()) {
-    return value;
+  const base::Value* value = GetPref(path);
+  if (!value || !value->is_string()) {
+    return "";
   }
 
-  bat_ads_client_->GetStringPref(path, &value);
-  return value;
+  return value->GetString();
 }
 
 void BatAdsClientMojoBridge::SetStringPref(
@@ -311,19 +313,24 @@ void BatAdsClientMojoBridge::SetStringPref(
     return;
   }
 
-  bat_ads_client_->SetStringPref(path, value);
+  SetPref(path, base::Value(value));
+
+  bat_ads_client_->SetStringPref(path, value,
+      base::BindOnce(&BatAdsClientMojoBridge::OnSetPref,
+          weak_factory_.GetWeakPtr(), path));
 }
 
 int64_t BatAdsClientMojoBridge::GetInt64Pref(
     const std::string& path) const {
-  int64_t value = 0;
-
-  if (!connected()) {
-    return value;
+  // 64-bit integers are serialized as strings by |PrefService|
+  const base::Value* value = GetPref(path);
+  if (!value || !value->is_string()) {
+    return 0;
   }
 
-  bat_ads_client_->GetInt64Pref(path, &value);
-  return value;
+  int64_t integer = 0;
+  base::StringToInt64(value->GetString(), &integer);
+  return integer;
 }
 
 void BatAdsClientMojoBridge::SetInt64Pref(
@@ -333,19 +340,24 @@ void BatAdsClientMojoBridge::SetInt64Pref(
     return;
   }
 
-  bat_ads_client_->SetInt64Pref(path, value);
+  SetPref(path, base::Value(base::NumberToString(value)));
+
+  bat_ads_client_->SetInt64Pref(path, value,
+      base::BindOnce(&BatAdsClientMojoBridge::OnSetPref,
+          weak_factory_.GetWeakPtr(), path));
 }
 
 uint64_t BatAdsClientMojoBridge::GetUint64Pref(
     const std::string& path) const {
-  uint64_t value = 0;
-
-  if (!connected()) {
-    return value;
+  // 64-bit integers are serialized as strings by |PrefService|
+  const base::Value* value = GetPref(path);
+  if (!value || !value->is_string()) {
+    return 0;
   }
 
-  bat_ads_client_->GetUint64Pref(path, &value);
-  return value;
+  uint64_t integer = 0;
+  base::StringToUint64(value->GetString(), &integer);
+  return integer;
 }
 
 void BatAdsClientMojoBridge::SetUint64Pref(
@@ -355,7 +367,11 @@ void BatAdsClientMojoBridge::SetUint64Pref(
     return;
   }
 
-  bat_ads_client_->SetUint64Pref(path, value);
+  SetPref(path, base::Value(base::NumberToString(value)));
+
+  bat_ads_client_->SetUint64Pref(path, value,
+      base::BindOnce(&BatAdsClientMojoBridge::OnSetPref,
+          weak_factory_.GetWeakPtr(), path));
 }
 
 void BatAdsClientMojoBridge::ClearPref(
@@ -364,7 +380,13 @@ void BatAdsClientMojoBridge::ClearPref(
     return;
   }
 
-  bat_ads_client_->ClearPref(path);
+  // The default value is only known to the browser process, so the mirror is
+  // updated by the resulting change notification once acknowledged
+  prefs_.AddPendingWrite(path);
+
+  bat_ads_client_->ClearPref(path,
+      base::BindOnce(&BatAdsClientMojoBridge::OnSetPref,
+          weak_factory_.GetWeakPtr(), path));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -373,4 +395,20 @@ bool BatAdsClientMojoBridge::connected() const {
   return bat_ads_client_.is_bound();
 }
 
+const base::Value* BatAdsClientMojoBridge::GetPref(
+    const std::string& path) const {
+  return prefs_.Get(path);
+}
+
+void BatAdsClientMojoBridge::SetPref(
+    const std::string& path,
+    base::Value value) {
+  prefs_.Set(path, std::move(value));
+}
+
+void BatAdsClientMojoBridge::OnSetPref(
+    const std::string& path) {
+  prefs_.OnWriteAcknowledged(path);
+}
+
 }  // namespace bat_ads
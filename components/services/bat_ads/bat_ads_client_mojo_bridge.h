@@ -10,8 +10,12 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "bat/ads/ads_client.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+#include "brave/components/services/common/mirrored_values.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
 #include "mojo/public/cpp/bindings/pending_associated_remote.h"
 
@@ -20,14 +24,20 @@ namespace bat_ads {
 class BatAdsClientMojoBridge
     : public ads::AdsClient {
  public:
-  explicit BatAdsClientMojoBridge(
-      mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info);
+  BatAdsClientMojoBridge(
+      mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
+      base::flat_map<std::string, base::Value> prefs);
 
   ~BatAdsClientMojoBridge() override;
 
   BatAdsClientMojoBridge(const BatAdsClientMojoBridge&) = delete;
   BatAdsClientMojoBridge& operator=(const BatAdsClientMojoBridge&) = delete;
 
+  // Called when a preference is changed in the browser process
+  void OnPrefChanged(
+      const std::string& path,
+      base::Value value);
+
   // AdsClient implementation
   bool IsNetworkConnectionAvailable() const override;
 
@@ -60,9 +70,6 @@ class BatAdsClientMojoBridge
       const std::string& name,
       ads::LoadCallback callback) override;
 
-  std::string LoadResourceForId(
-      const std::string& id) override;
-
   void RunDBTransaction(
       ads::DBTransactionPtr transaction,
       ads::RunDBTransactionCallback callback) override;
@@ -123,7 +130,21 @@ class BatAdsClientMojoBridge
  private:
   bool connected() const;
 
+  const base::Value* GetPref(
+      const std::string& path) const;
+  void SetPref(
+      const std::string& path,
+      base::Value value);
+  void OnSetPref(
+      const std::string& path);
+
   mojo::AssociatedRemote<mojom::BatAdsClient> bat_ads_client_;
+
+  // Preferences are mirrored locally so that reads never block on a
+  // synchronous round trip to the browser process
+  MirroredValues prefs_;
+
+  base::WeakPtrFactory<BatAdsClientMojoBridge> weak_factory_{this};
 };
 
 }  // namespace bat_ads
@@ -36,9 +36,10 @@ ads::CategoryContentInfo::OptAction ToAdsOptAction(
 }  // namespace
 
 BatAdsImpl::BatAdsImpl(
-    mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info) :
+    mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
+    base::flat_map<std::string, base::Value> prefs) :
     bat_ads_client_mojo_proxy_(new BatAdsClientMojoBridge(
-        std::move(client_info))),
+        std::move(client_info), std::move(prefs))),
     ads_(ads::Ads::CreateInstance(bat_ads_client_mojo_proxy_.get())) {
 }
 
@@ -241,6 +242,12 @@ void BatAdsImpl::OnUserModelUpdated(
   ads_->OnUserModelUpdated(id);
 }
 
+void BatAdsImpl::OnPrefChanged(
+    const std::string& path,
+    base::Value value) {
+  bat_ads_client_mojo_proxy_->OnPrefChanged(path, std::move(value));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void BatAdsImpl::OnInitialize(
@@ -12,7 +12,9 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
 #include "mojo/public/cpp/bindings/interface_request.h"
 #include "bat/ads/ads.h"
@@ -30,8 +32,9 @@ class BatAdsImpl :
     public mojom::BatAds,
     public base::SupportsWeakPtr<BatAdsImpl> {
  public:
-  explicit BatAdsImpl(
-      mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info);
+  BatAdsImpl(
+      mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
+      base::flat_map<std::string, base::Value> prefs);
   ~BatAdsImpl() override;
 
   BatAdsImpl(const BatAdsImpl&) = delete;
@@ -134,6 +137,10 @@ class BatAdsImpl :
   void OnUserModelUpdated(
       const std::string& id) override;
 
+  void OnPrefChanged(
+      const std::string& path,
+      base::Value value) override;
+
  private:
   // Workaround to pass base::OnceCallback into std::bind
   template <typename Callback>
@@ -23,10 +23,11 @@ BatAdsServiceImpl::~BatAdsServiceImpl() {}
 void BatAdsServiceImpl::Create(
     mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
     mojo::PendingAssociatedReceiver<mojom::BatAds> bat_ads,
+    base::flat_map<std::string, base::Value> prefs,
     CreateCallback callback) {
 
   associated_receivers_.Add(
-      std::make_unique<BatAdsImpl>(std::move(client_info)),
+      std::make_unique<BatAdsImpl>(std::move(client_info), std::move(prefs)),
       std::move(bat_ads));
   is_initialized_ = true;
   std::move(callback).Run();
@@ -9,7 +9,9 @@
 #include <string>
 #include <memory>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/ref_counted.h"
+#include "base/values.h"
 #include "bat/ads/ads.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
 #include "mojo/public/cpp/bindings/pending_associated_receiver.h"
@@ -34,6 +36,7 @@ class BatAdsServiceImpl : public mojom::BatAdsService {
   void Create(
       mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
       mojo::PendingAssociatedReceiver<mojom::BatAds> bat_ads,
+      base::flat_map<std::string, base::Value> prefs,
       CreateCallback callback) override;
 
   void SetEnvironment(
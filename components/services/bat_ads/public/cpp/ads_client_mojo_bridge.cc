@@ -65,20 +65,6 @@ void AdsClientMojoBridge::ShouldShowNotifications(
   std::move(callback).Run(ads_client_->ShouldShowNotifications());
 }
 
-bool AdsClientMojoBridge::LoadResourceForId(
-    const std::string& id,
-    std::string* out_value) {
-  DCHECK(out_value);
-  *out_value = ads_client_->LoadResourceForId(id);
-  return true;
-}
-
-void AdsClientMojoBridge::LoadResourceForId(
-    const std::string& id,
-    LoadResourceForIdCallback callback) {
-  std::move(callback).Run(ads_client_->LoadResourceForId(id));
-}
-
 void AdsClientMojoBridge::Log(
     const std::string& file,
     const int32_t line,
@@ -229,81 +215,59 @@ void AdsClientMojoBridge::OnAdRewardsChanged() {
   ads_client_->OnAdRewardsChanged();
 }
 
-void AdsClientMojoBridge::GetBooleanPref(
-    const std::string& path,
-    GetBooleanPrefCallback callback) {
-  std::move(callback).Run(ads_client_->GetBooleanPref(path));
-}
-
 void AdsClientMojoBridge::SetBooleanPref(
     const std::string& path,
-    const bool value) {
+    const bool value,
+    SetBooleanPrefCallback callback) {
   ads_client_->SetBooleanPref(path, value);
-}
-
-void AdsClientMojoBridge::GetIntegerPref(
-    const std::string& path,
-    GetIntegerPrefCallback callback) {
-  std::move(callback).Run(ads_client_->GetIntegerPref(path));
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::SetIntegerPref(
     const std::string& path,
-    const int value) {
+    const int value,
+    SetIntegerPrefCallback callback) {
   ads_client_->SetIntegerPref(path, value);
-}
-
-void AdsClientMojoBridge::GetDoublePref(
-    const std::string& path,
-    GetDoublePrefCallback callback) {
-  std::move(callback).Run(ads_client_->GetDoublePref(path));
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::SetDoublePref(
     const std::string& path,
-    const double value) {
+    const double value,
+    SetDoublePrefCallback callback) {
   ads_client_->SetDoublePref(path, value);
-}
-
-void AdsClientMojoBridge::GetStringPref(
-    const std::string& path,
-    GetStringPrefCallback callback) {
-  std::move(callback).Run(ads_client_->GetStringPref(path));
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::SetStringPref(
     const std::string& path,
-    const std::string& value) {
+    const std::string& value,
+    SetStringPrefCallback callback) {
   ads_client_->SetStringPref(path, value);
-}
-
-void AdsClientMojoBridge::GetInt64Pref(
-    const std::string& path,
-    GetInt64PrefCallback callback) {
-  std::move(callback).Run(ads_client_->GetInt64Pref(path));
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::SetInt64Pref(
     const std::string& path,
-    const int64_t value) {
+    const int64_t value,
+    SetInt64PrefCallback callback) {
   ads_client_->SetInt64Pref(path, value);
-}
-
-void AdsClientMojoBridge::GetUint64Pref(
-    const std::string& path,
-    GetUint64PrefCallback callback) {
-  std::move(callback).Run(ads_client_->GetUint64Pref(path));
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::SetUint64Pref(
     const std::string& path,
-    const uint64_t value) {
+    const uint64_t value,
+    SetUint64PrefCallback callback) {
   ads_client_->SetUint64Pref(path, value);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::ClearPref(
-    const std::string& path) {
+    const std::string& path,
+    ClearPrefCallback callback) {
   ads_client_->ClearPref(path);
+  std::move(callback).Run();
 }
 
 }  // namespace bat_ads
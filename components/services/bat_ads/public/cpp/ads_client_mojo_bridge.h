@@ -43,12 +43,6 @@ class AdsClientMojoBridge
       bool* out_should_show) override;
   void ShouldShowNotifications(
       ShouldShowNotificationsCallback callback) override;
-  bool LoadResourceForId(
-      const std::string& id,
-      std::string* out_value) override;
-  void LoadResourceForId(
-      const std::string& id,
-      LoadResourceForIdCallback callback) override;
   void Log(
       const std::string& file,
       const int32_t line,
@@ -82,44 +76,33 @@ class AdsClientMojoBridge
       RunDBTransactionCallback callback) override;
   void OnAdRewardsChanged() override;
 
-  void GetBooleanPref(
-      const std::string& path,
-      GetBooleanPrefCallback callback) override;
   void SetBooleanPref(
       const std::string& path,
-      const bool value) override;
-  void GetIntegerPref(
-      const std::string& path,
-      GetIntegerPrefCallback callback) override;
+      const bool value,
+      SetBooleanPrefCallback callback) override;
   void SetIntegerPref(
       const std::string& path,
-      const int value) override;
-  void GetDoublePref(
-      const std::string& path,
-      GetDoublePrefCallback callback) override;
+      const int value,
+      SetIntegerPrefCallback callback) override;
   void SetDoublePref(
       const std::string& path,
-      const double value) override;
-  void GetStringPref(
-      const std::string& path,
-      GetStringPrefCallback callback) override;
+      const double value,
+      SetDoublePrefCallback callback) override;
   void SetStringPref(
       const std::string& path,
-      const std::string& value) override;
-  void GetInt64Pref(
-      const std::string& path,
-      GetInt64PrefCallback callback) override;
+      const std::string& value,
+      SetStringPrefCallback callback) override;
   void SetInt64Pref(
       const std::string& path,
-      const int64_t value) override;
-  void GetUint64Pref(
-      const std::string& path,
-      GetUint64PrefCallback callback) override;
+      const int64_t value,
+      SetInt64PrefCallback callback) override;
   void SetUint64Pref(
       const std::string& path,
-      const uint64_t value) override;
+      const uint64_t value,
+      SetUint64PrefCallback callback) override;
   void ClearPref(
-      const std::string& path) override;
+      const std::string& path,
+      ClearPrefCallback callback) override;
 
  private:
   // workaround to pass base::OnceCallback into std::bind
@@ -10,17 +10,42 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
 
 namespace bat_ledger {
 
 BatLedgerClientMojoBridge::BatLedgerClientMojoBridge(
-      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info) {
+      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
+      base::flat_map<std::string, base::Value> state,
+      base::flat_map<std::string, base::Value> options)
+    : state_(std::move(state)),
+      options_(std::move(options)) {
   bat_ledger_client_.Bind(std::move(client_info));
 }
 
 BatLedgerClientMojoBridge::~BatLedgerClientMojoBridge() = default;
 
+void BatLedgerClientMojoBridge::OnStateChanged(
+    const std::string& name,
+    base::Value value) {
+  encrypted_string_state_.erase(name);
+
+  if (!state_.OnChanged(name, std::move(value))) {
+    return;
+  }
+
+  if (state_changed_callback_) {
+    state_changed_callback_.Run(name);
+  }
+}
+
+void BatLedgerClientMojoBridge::set_state_changed_callback(
+    base::RepeatingCallback<void(const std::string&)> callback) {
+  state_changed_callback_ = std::move(callback);
+}
+
 void OnLoadURL(
     const ledger::client::LoadURLCallback& callback,
     ledger::type::UrlResponsePtr response_ptr) {
@@ -150,123 +175,263 @@ void BatLedgerClientMojoBridge::PublisherListNormalized(
 
 void BatLedgerClientMojoBridge::SetBooleanState(const std::string& name,
                                                bool value) {
-  bat_ledger_client_->SetBooleanState(name, value);
+  if (!Connected()) {
+    return;
+  }
+
+  SetState(name, base::Value(value));
+
+  bat_ledger_client_->SetBooleanState(name, value,
+      base::BindOnce(&BatLedgerClientMojoBridge::OnSetState,
+          AsWeakPtr(), name));
 }
 
 bool BatLedgerClientMojoBridge::GetBooleanState(const std::string& name) const {
-  bool value;
-  bat_ledger_client_->GetBooleanState(name, &value);
-  return value;
+  const base::Value* value = GetState(name);
+  if (!value || !value->is_bool()) {
+    return false;
+  }
+
+  return value->GetBool();
 }
 
 void BatLedgerClientMojoBridge::SetIntegerState(const std::string& name,
                                                int value) {
-  bat_ledger_client_->SetIntegerState(name, value);
+  if (!Connected()) {
+    return;
+  }
+
+  SetState(name, base::Value(value));
+
+  bat_ledger_client_->SetIntegerState(name, value,
+      base::BindOnce(&BatLedgerClientMojoBridge::OnSetState,
+          AsWeakPtr(), name));
 }
 
 int BatLedgerClientMojoBridge::GetIntegerState(const std::string& name) const {
-  int value;
-  bat_ledger_client_->GetIntegerState(name, &value);
-  return value;
+  const base::Value* value = GetState(name);
+  if (!value || !value->is_int()) {
+    return 0;
+  }
+
+  return value->GetInt();
 }
 
 void BatLedgerClientMojoBridge::SetDoubleState(const std::string& name,
                                               double value) {
-  bat_ledger_client_->SetDoubleState(name, value);
+  if (!Connected()) {
+    return;
+  }
+
+  SetState(name, base::Value(value));
+
+  bat_ledger_client_->SetDoubleState(name, value,
+      base::BindOnce(&BatLedgerClientMojoBridge::OnSetState,
+          AsWeakPtr(), name));
 }
 
 double BatLedgerClientMojoBridge::GetDoubleState(
     const std::string& name) const {
-  double value;
-  bat_ledger_client_->GetDoubleState(name, &value);
-  return value;
+  const base::Value* value = GetState(name);
+  if (!value || !(value->is_double() || value->is_int())) {
+    return 0.0;
+  }
+
+  return value->GetDouble();
 }
 
 void BatLedgerClientMojoBridge::SetStringState(const std::string& name,
                               const std::string& value) {
-  bat_ledger_client_->SetStringState(name, value);
+  if (!Connected()) {
+    return;
+  }
+
+  SetState(name, base::Value(value));
+
+  bat_ledger_client_->SetStringState(name, value,
+      base::BindOnce(&BatLedgerClientMojoBridge::OnSetState,
+          AsWeakPtr(), name));
 }
 
 std::string BatLedgerClientMojoBridge::
 GetStringState(const std::string& name) const {
-  std::string value;
-  bat_ledger_client_->GetStringState(name, &value);
-  return value;
+  const base::Value* value = GetState(name);
+  if (!value || !value->is_string()) {
+    return "";
+  }
+
+  return value->GetString();
 }
 
 void BatLedgerClientMojoBridge::SetInt64State(const std::string& name,
                                              int64_t value) {
-  bat_ledger_client_->SetInt64State(name, value);
+  if (!Connected()) {
+    return;
+  }
+
+  SetState(name, base::Value(base::NumberToString(value)));
+
+  bat_ledger_client_->SetInt64State(name, value,
+      base::BindOnce(&BatLedgerClientMojoBridge::OnSetState,
+          AsWeakPtr(), name));
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64State(
     const std::string& name) const {
-  int64_t value;
-  bat_ledger_client_->GetInt64State(name, &value);
-  return value;
+  // 64-bit integers are serialized as strings by |PrefService|
+  const base::Value* value = GetState(name);
+  if (!value || !value->is_string()) {
+    return 0;
+  }
+
+  int64_t integer = 0;
+  base::StringToInt64(value->GetString(), &integer);
+  return integer;
 }
 
 void BatLedgerClientMojoBridge::SetUint64State(const std::string& name,
                                               uint64_t value) {
-  bat_ledger_client_->SetUint64State(name, value);
+  if (!Connected()) {
+    return;
+  }
+
+  SetState(name, base::Value(base::NumberToString(value)));
+
+  bat_ledger_client_->SetUint64State(name, value,
+      base::BindOnce(&BatLedgerClientMojoBridge::OnSetState,
+          AsWeakPtr(), name));
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64State(
     const std::string& name) const {
-  uint64_t value;
-  bat_ledger_client_->GetUint64State(name, &value);
-  return value;
+  // 64-bit integers are serialized as strings by |PrefService|
+  const base::Value* value = GetState(name);
+  if (!value || !value->is_string()) {
+    return 0;
+  }
+
+  uint64_t integer = 0;
+  base::StringToUint64(value->GetString(), &integer);
+  return integer;
 }
 
 void BatLedgerClientMojoBridge::ClearState(const std::string& name) {
-  bat_ledger_client_->ClearState(name);
+  if (!Connected()) {
+    return;
+  }
+
+  // The default value is only known to the browser process, so the cache is
+  // updated by the resulting change notification once acknowledged
+  state_.AddPendingWrite(name);
+
+  bat_ledger_client_->ClearState(name,
+      base::BindOnce(&BatLedgerClientMojoBridge::OnSetState,
+          AsWeakPtr(), name));
 }
 
 bool BatLedgerClientMojoBridge::GetBooleanOption(
     const std::string& name) const {
-  bool value;
-  bat_ledger_client_->GetBooleanOption(name, &value);
-  return value;
+  const base::Value* value = GetOption(name);
+  if (!value || !value->is_bool()) {
+    return false;
+  }
+
+  return value->GetBool();
 }
 
 int BatLedgerClientMojoBridge::GetIntegerOption(const std::string& name) const {
-  int value;
-  bat_ledger_client_->GetIntegerOption(name, &value);
-  return value;
+  const base::Value* value = GetOption(name);
+  if (!value || !value->is_int()) {
+    return 0;
+  }
+
+  return value->GetInt();
 }
 
 double BatLedgerClientMojoBridge::GetDoubleOption(
     const std::string& name) const {
-  double value;
-  bat_ledger_client_->GetDoubleOption(name, &value);
-  return value;
+  const base::Value* value = GetOption(name);
+  if (!value || !(value->is_double() || value->is_int())) {
+    return 0.0;
+  }
+
+  return value->GetDouble();
 }
 
 std::string BatLedgerClientMojoBridge::GetStringOption(
     const std::string& name) const {
-  std::string value;
-  bat_ledger_client_->GetStringOption(name, &value);
-  return value;
+  const base::Value* value = GetOption(name);
+  if (!value || !value->is_string()) {
+    return "";
+  }
+
+  return value->GetString();
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64Option(
     const std::string& name) const {
-  int64_t value;
-  bat_ledger_client_->GetInt64Option(name, &value);
-  return value;
+  const base::Value* value = GetOption(name);
+  if (!value || !value->is_string()) {
+    return 0;
+  }
+
+  int64_t integer = 0;
+  base::StringToInt64(value->GetString(), &integer);
+  return integer;
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64Option(
     const std::string& name) const {
-  uint64_t value;
-  bat_ledger_client_->GetUint64Option(name, &value);
-  return value;
+  const base::Value* value = GetOption(name);
+  if (!value || !value->is_string()) {
+    return 0;
+  }
+
+  uint64_t integer = 0;
+  base::StringToUint64(value->GetString(), &integer);
+  return integer;
 }
 
 bool BatLedgerClientMojoBridge::Connected() const {
   return bat_ledger_client_.is_bound();
 }
 
+const base::Value* BatLedgerClientMojoBridge::GetState(
+    const std::string& name) const {
+  return state_.Get(name);
+}
+
+void BatLedgerClientMojoBridge::SetState(
+    const std::string& name,
+    base::Value value) {
+  state_.Set(name, std::move(value));
+}
+
+void BatLedgerClientMojoBridge::OnSetState(const std::string& name) {
+  if (!state_.OnWriteAcknowledged(name)) {
+    return;
+  }
+
+  encrypted_string_state_.erase(name);
+
+  if (state_changed_callback_) {
+    state_changed_callback_.Run(name);
+  }
+}
+
+const base::Value* BatLedgerClientMojoBridge::GetOption(
+    const std::string& name) const {
+  DCHECK(!name.empty());
+
+  const auto iter = options_.find(name);
+  if (iter == options_.end()) {
+    NOTREACHED() << "Unknown option " << name;
+    return nullptr;
+  }
+
+  return &iter->second;
+}
+
 void BatLedgerClientMojoBridge::OnContributeUnverifiedPublishers(
       ledger::type::Result result,
       const std::string& publisher_key,
@@ -304,9 +469,14 @@ void BatLedgerClientMojoBridge::ShowNotification(
 }
 
 ledger::type::ClientInfoPtr BatLedgerClientMojoBridge::GetClientInfo() {
-  auto info = ledger::type::ClientInfo::New();
-  bat_ledger_client_->GetClientInfo(&info);
-  return info;
+  // Client info does not change for the lifetime of the browser process
+  if (!client_info_) {
+    auto info = ledger::type::ClientInfo::New();
+    bat_ledger_client_->GetClientInfo(&info);
+    client_info_ = std::move(info);
+  }
+
+  return client_info_.Clone();
 }
 
 void BatLedgerClientMojoBridge::UnblindedTokensReady() {
@@ -375,13 +545,28 @@ bool BatLedgerClientMojoBridge::SetEncryptedStringState(
     const std::string& value) {
   bool success;
   bat_ledger_client_->SetEncryptedStringState(name, value, &success);
+
+  // A change notification for this name arriving after the reply invalidates
+  // the cached value, which is then decrypted again on the next read
+  if (success) {
+    encrypted_string_state_[name] = value;
+  } else {
+    encrypted_string_state_.erase(name);
+  }
+
   return success;
 }
 
 std::string BatLedgerClientMojoBridge::GetEncryptedStringState(
     const std::string& name) {
+  const auto iter = encrypted_string_state_.find(name);
+  if (iter != encrypted_string_state_.end()) {
+    return iter->second;
+  }
+
   std::string value;
   bat_ledger_client_->GetEncryptedStringState(name, &value);
+  encrypted_string_state_[name] = value;
   return value;
 }
 
@@ -11,9 +11,13 @@
 #include <string>
 #include <vector>
 
+#include "base/callback.h"
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "bat/ledger/ledger_client.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
+#include "brave/components/services/common/mirrored_values.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
 #include "mojo/public/cpp/bindings/pending_associated_remote.h"
 
@@ -24,13 +28,23 @@ class BatLedgerClientMojoBridge :
     public base::SupportsWeakPtr<BatLedgerClientMojoBridge>{
  public:
   BatLedgerClientMojoBridge(
-      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info);
+      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
+      base::flat_map<std::string, base::Value> state,
+      base::flat_map<std::string, base::Value> options);
   ~BatLedgerClientMojoBridge() override;
 
   BatLedgerClientMojoBridge(const BatLedgerClientMojoBridge&) = delete;
   BatLedgerClientMojoBridge& operator=(
       const BatLedgerClientMojoBridge&) = delete;
 
+  // Called when state is changed in the browser process
+  void OnStateChanged(const std::string& name, base::Value value);
+
+  // |callback| is run whenever a change made by the browser process has been
+  // applied to the cached state
+  void set_state_changed_callback(
+      base::RepeatingCallback<void(const std::string&)> callback);
+
   void OnReconcileComplete(
       const ledger::type::Result result,
       ledger::type::ContributionInfoPtr contribution) override;
@@ -127,7 +141,26 @@ class BatLedgerClientMojoBridge :
  private:
   bool Connected() const;
 
+  const base::Value* GetState(const std::string& name) const;
+  void SetState(const std::string& name, base::Value value);
+  void OnSetState(const std::string& name);
+
+  const base::Value* GetOption(const std::string& name) const;
+
   mojo::AssociatedRemote<mojom::BatLedgerClient> bat_ledger_client_;
+
+  // State is mirrored locally so that reads never block the ledger sequence
+  // on a synchronous round trip to the browser process
+  MirroredValues state_;
+  base::RepeatingCallback<void(const std::string&)> state_changed_callback_;
+
+  // Decrypted values are cached after the first read and invalidated whenever
+  // the underlying state changes
+  std::map<std::string, std::string> encrypted_string_state_;
+
+  const base::flat_map<std::string, base::Value> options_;
+
+  ledger::type::ClientInfoPtr client_info_;
 };
 
 }  // namespace bat_ledger
@@ -12,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/containers/flat_map.h"
 #include "brave/components/services/bat_ledger/bat_ledger_client_mojo_bridge.h"
 
@@ -22,11 +23,19 @@ using std::placeholders::_3;
 namespace bat_ledger {
 
 BatLedgerImpl::BatLedgerImpl(
-    mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info)
+    mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
+    base::flat_map<std::string, base::Value> state,
+    base::flat_map<std::string, base::Value> options)
   : bat_ledger_client_mojo_bridge_(
-      new BatLedgerClientMojoBridge(std::move(client_info))),
+      new BatLedgerClientMojoBridge(std::move(client_info), std::move(state),
+          std::move(options))),
     ledger_(
       ledger::Ledger::CreateInstance(bat_ledger_client_mojo_bridge_.get())) {
+  // |ledger_| is destroyed before the bridge, which only runs the callback
+  // for incoming messages
+  bat_ledger_client_mojo_bridge_->set_state_changed_callback(
+      base::BindRepeating(&ledger::Ledger::OnStateChanged,
+          base::Unretained(ledger_.get())));
 }
 
 BatLedgerImpl::~BatLedgerImpl() = default;
@@ -1152,4 +1161,10 @@ void BatLedgerImpl::GetWalletPassphrase(GetWalletPassphraseCallback callback) {
   std::move(callback).Run(ledger_->GetWalletPassphrase());
 }
 
+void BatLedgerImpl::OnStateChanged(
+    const std::string& name,
+    base::Value value) {
+  bat_ledger_client_mojo_bridge_->OnStateChanged(name, std::move(value));
+}
+
 }  // namespace bat_ledger
@@ -15,6 +15,7 @@
 
 #include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "bat/ledger/ledger.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
 
@@ -26,8 +27,10 @@ class BatLedgerImpl :
     public mojom::BatLedger,
     public base::SupportsWeakPtr<BatLedgerImpl> {
  public:
-  explicit BatLedgerImpl(
-      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info);
+  BatLedgerImpl(
+      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
+      base::flat_map<std::string, base::Value> state,
+      base::flat_map<std::string, base::Value> options);
   ~BatLedgerImpl() override;
 
   BatLedgerImpl(const BatLedgerImpl&) = delete;
@@ -247,6 +250,8 @@ class BatLedgerImpl :
 
   void GetWalletPassphrase(GetWalletPassphraseCallback callback) override;
 
+  void OnStateChanged(const std::string& name, base::Value value) override;
+
  private:
   // workaround to pass base::OnceCallback into std::bind
   template <typename Callback>
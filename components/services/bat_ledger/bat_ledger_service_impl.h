@@ -7,7 +7,10 @@
 #define BRAVE_COMPONENTS_SERVICES_BAT_LEDGER_BAT_LEDGER_SERVICE_IMPL_H_
 
 #include <memory>
+#include <string>
 
+#include "base/containers/flat_map.h"
+#include "base/values.h"
 #include "bat/ledger/ledger.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
 #include "mojo/public/cpp/bindings/pending_associated_receiver.h"
@@ -32,6 +35,8 @@ class BatLedgerServiceImpl : public mojom::BatLedgerService {
   void Create(
       mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
       mojo::PendingAssociatedReceiver<mojom::BatLedger> bat_ledger,
+      base::flat_map<std::string, base::Value> state,
+      base::flat_map<std::string, base::Value> options,
       CreateCallback callback) override;
 
   void SetEnvironment(ledger::type::Environment environment) override;
@@ -132,103 +132,51 @@ void LedgerClientMojoBridge::PublisherListNormalized(
 }
 
 void LedgerClientMojoBridge::SetBooleanState(const std::string& name,
-                                            bool value) {
+                                             bool value,
+                                             SetBooleanStateCallback callback) {
   ledger_client_->SetBooleanState(name, value);
-}
-
-void LedgerClientMojoBridge::GetBooleanState(const std::string& name,
-                                            GetBooleanStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetBooleanState(name));
+  std::move(callback).Run();
 }
 
 void LedgerClientMojoBridge::SetIntegerState(const std::string& name,
-                                            int value) {
+                                             int value,
+                                             SetIntegerStateCallback callback) {
   ledger_client_->SetIntegerState(name, value);
-}
-
-void LedgerClientMojoBridge::GetIntegerState(const std::string& name,
-                                            GetIntegerStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetIntegerState(name));
+  std::move(callback).Run();
 }
 
 void LedgerClientMojoBridge::SetDoubleState(const std::string& name,
-                                           double value) {
+                                            double value,
+                                            SetDoubleStateCallback callback) {
   ledger_client_->SetDoubleState(name, value);
-}
-
-void LedgerClientMojoBridge::GetDoubleState(const std::string& name,
-                                           GetDoubleStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetDoubleState(name));
+  std::move(callback).Run();
 }
 
 void LedgerClientMojoBridge::SetStringState(const std::string& name,
-                                           const std::string& value) {
+                                            const std::string& value,
+                                            SetStringStateCallback callback) {
   ledger_client_->SetStringState(name, value);
-}
-
-void LedgerClientMojoBridge::GetStringState(const std::string& name,
-                                           GetStringStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetStringState(name));
+  std::move(callback).Run();
 }
 
 void LedgerClientMojoBridge::SetInt64State(const std::string& name,
-                                          int64_t value) {
+                                           int64_t value,
+                                           SetInt64StateCallback callback) {
   ledger_client_->SetInt64State(name, value);
-}
-
-void LedgerClientMojoBridge::GetInt64State(const std::string& name,
-                                          GetInt64StateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetInt64State(name));
+  std::move(callback).Run();
 }
 
 void LedgerClientMojoBridge::SetUint64State(const std::string& name,
-                                           uint64_t value) {
+                                            uint64_t value,
+                                            SetUint64StateCallback callback) {
   ledger_client_->SetUint64State(name, value);
+  std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetUint64State(const std::string& name,
-                                           GetUint64StateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetUint64State(name));
-}
-
-void LedgerClientMojoBridge::ClearState(const std::string& name) {
+void LedgerClientMojoBridge::ClearState(const std::string& name,
+                                        ClearStateCallback callback) {
   ledger_client_->ClearState(name);
-}
-
-void LedgerClientMojoBridge::GetBooleanOption(
-    const std::string& name,
-    GetBooleanOptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetBooleanOption(name));
-}
-
-void LedgerClientMojoBridge::GetIntegerOption(
-    const std::string& name,
-    GetIntegerOptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetIntegerOption(name));
-}
-
-void LedgerClientMojoBridge::GetDoubleOption(
-    const std::string& name,
-    GetDoubleOptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetDoubleOption(name));
-}
-
-void LedgerClientMojoBridge::GetStringOption(
-    const std::string& name,
-    GetStringOptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetStringOption(name));
-}
-
-void LedgerClientMojoBridge::GetInt64Option(
-    const std::string& name,
-    GetInt64OptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetInt64Option(name));
-}
-
-void LedgerClientMojoBridge::GetUint64Option(
-    const std::string& name,
-    GetUint64OptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetUint64Option(name));
+  std::move(callback).Run();
 }
 
 void LedgerClientMojoBridge::OnContributeUnverifiedPublishers(
@@ -0,0 +1,69 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/common/mirrored_values.h"
+
+#include <utility>
+
+#include "base/logging.h"
+
+MirroredValues::MirroredValues(
+    base::flat_map<std::string, base::Value> values)
+    : values_(std::move(values)) {}
+
+MirroredValues::~MirroredValues() = default;
+
+const base::Value* MirroredValues::Get(const std::string& name) const {
+  const auto iter = values_.find(name);
+  if (iter == values_.end()) {
+    return nullptr;
+  }
+
+  return &iter->second;
+}
+
+void MirroredValues::Set(const std::string& name, base::Value value) {
+  values_[name] = std::move(value);
+  AddPendingWrite(name);
+}
+
+void MirroredValues::AddPendingWrite(const std::string& name) {
+  pending_writes_[name]++;
+}
+
+bool MirroredValues::OnWriteAcknowledged(const std::string& name) {
+  const auto iter = pending_writes_.find(name);
+  DCHECK(iter != pending_writes_.end());
+
+  iter->second--;
+  if (iter->second > 0) {
+    return false;
+  }
+
+  pending_writes_.erase(iter);
+
+  // Apply the most recent change made by the browser process while our writes
+  // were in flight, which reflects the value the browser process now holds
+  const auto deferred_iter = deferred_changes_.find(name);
+  if (deferred_iter == deferred_changes_.end()) {
+    return false;
+  }
+
+  values_[name] = std::move(deferred_iter->second);
+  deferred_changes_.erase(deferred_iter);
+
+  return true;
+}
+
+bool MirroredValues::OnChanged(const std::string& name, base::Value value) {
+  if (pending_writes_.find(name) != pending_writes_.end()) {
+    deferred_changes_[name] = std::move(value);
+    return false;
+  }
+
+  values_[name] = std::move(value);
+
+  return true;
+}
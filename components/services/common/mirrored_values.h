@@ -0,0 +1,52 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_SERVICES_COMMON_MIRRORED_VALUES_H_
+#define BRAVE_COMPONENTS_SERVICES_COMMON_MIRRORED_VALUES_H_
+
+#include <map>
+#include <string>
+
+#include "base/containers/flat_map.h"
+#include "base/values.h"
+
+// Local mirror of values owned by the browser process, so that utility
+// processes can read them without a synchronous round trip. Changes made by
+// the browser process while writes for the same name are still in flight are
+// deferred until the last write has been acknowledged, so that echoes of our
+// own writes never overwrite a newer local value
+class MirroredValues {
+ public:
+  explicit MirroredValues(base::flat_map<std::string, base::Value> values);
+  ~MirroredValues();
+
+  MirroredValues(const MirroredValues&) = delete;
+  MirroredValues& operator=(const MirroredValues&) = delete;
+
+  // Returns nullptr if |name| is not mirrored
+  const base::Value* Get(const std::string& name) const;
+
+  // Updates the mirror for a write which has been sent to the browser process
+  void Set(const std::string& name, base::Value value);
+
+  // Records a write whose resulting value is only known to the browser
+  // process, i.e. clearing a value back to its default
+  void AddPendingWrite(const std::string& name);
+
+  // Called when the browser process has acknowledged a write for |name|.
+  // Returns true if a deferred change was applied to the mirror
+  bool OnWriteAcknowledged(const std::string& name);
+
+  // Called when |name| was changed in the browser process. Returns true if the
+  // change was applied to the mirror, or false if it was deferred
+  bool OnChanged(const std::string& name, base::Value value);
+
+ private:
+  base::flat_map<std::string, base::Value> values_;
+  std::map<std::string, int> pending_writes_;
+  std::map<std::string, base::Value> deferred_changes_;
+};
+
+#endif  // BRAVE_COMPONENTS_SERVICES_COMMON_MIRRORED_VALUES_H_
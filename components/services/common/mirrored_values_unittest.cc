@@ -0,0 +1,92 @@
+/* Copyright (c) 2020 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/common/mirrored_values.h"
+
+#include <string>
+#include <utility>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+constexpr char kName[] = "brave.mirrored_test";
+
+}  // namespace
+
+class MirroredValuesTest : public ::testing::Test {
+ public:
+  MirroredValuesTest() : values_(CreateValues()) {}
+
+ protected:
+  static base::flat_map<std::string, base::Value> CreateValues() {
+    base::flat_map<std::string, base::Value> values;
+    values[kName] = base::Value(1);
+    return values;
+  }
+
+  int GetInt() const {
+    const base::Value* value = values_.Get(kName);
+    EXPECT_TRUE(value && value->is_int());
+    return value ? value->GetInt() : 0;
+  }
+
+  MirroredValues values_;
+};
+
+TEST_F(MirroredValuesTest, ReadsInitialValue) {
+  EXPECT_EQ(1, GetInt());
+  EXPECT_EQ(nullptr, values_.Get("brave.unknown"));
+}
+
+TEST_F(MirroredValuesTest, AppliesChangeWithoutPendingWrites) {
+  EXPECT_TRUE(values_.OnChanged(kName, base::Value(2)));
+  EXPECT_EQ(2, GetInt());
+}
+
+TEST_F(MirroredValuesTest, IgnoresEchoOfInFlightWrite) {
+  values_.Set(kName, base::Value(2));
+  values_.Set(kName, base::Value(3));
+
+  // Echo of the first write arrives before either write is acknowledged
+  EXPECT_FALSE(values_.OnChanged(kName, base::Value(2)));
+  EXPECT_EQ(3, GetInt());
+
+  EXPECT_FALSE(values_.OnWriteAcknowledged(kName));
+  EXPECT_EQ(3, GetInt());
+
+  // Echo of the second write is applied after the last acknowledgement
+  EXPECT_FALSE(values_.OnChanged(kName, base::Value(3)));
+  EXPECT_TRUE(values_.OnWriteAcknowledged(kName));
+  EXPECT_EQ(3, GetInt());
+}
+
+TEST_F(MirroredValuesTest, AppliesNewerBrowserValueAfterLastAcknowledgement) {
+  values_.Set(kName, base::Value(2));
+  values_.Set(kName, base::Value(3));
+
+  EXPECT_FALSE(values_.OnChanged(kName, base::Value(4)));
+  EXPECT_EQ(3, GetInt());
+
+  EXPECT_FALSE(values_.OnWriteAcknowledged(kName));
+  EXPECT_EQ(3, GetInt());
+
+  EXPECT_TRUE(values_.OnWriteAcknowledged(kName));
+  EXPECT_EQ(4, GetInt());
+
+  // Later changes are applied immediately
+  EXPECT_TRUE(values_.OnChanged(kName, base::Value(5)));
+  EXPECT_EQ(5, GetInt());
+}
+
+TEST_F(MirroredValuesTest, AppliesBrowserValueAfterClearIsAcknowledged) {
+  values_.AddPendingWrite(kName);
+
+  EXPECT_FALSE(values_.OnChanged(kName, base::Value(0)));
+  EXPECT_EQ(1, GetInt());
+
+  EXPECT_TRUE(values_.OnWriteAcknowledged(kName));
+  EXPECT_EQ(0, GetInt());
+}
@@ -29,3 +29,14 @@ void BraveExternalProcessImporterBridge::SetCreditCard(
       expiration_year, decrypted_card_number,
       origin);
 }
+
+void BraveExternalProcessImporterBridge::SetHistoryItems(
+    const std::vector<ImporterURLRow>& rows,
+    importer::VisitSource visit_source) {
+  brave_observer_->OnHistoryImportBatch(rows, visit_source);
+}
+
+void BraveExternalProcessImporterBridge::SetFavicons(
+    const favicon_base::FaviconUsageDataList& favicons) {
+  brave_observer_->OnFaviconsImportBatch(favicons);
+}
@@ -7,6 +7,7 @@
 #define BRAVE_UTILITY_IMPORTER_BRAVE_EXTERNAL_PROCESS_IMPORTER_BRIDGE_H_
 
 #include <string>
+#include <vector>
 
 #include "brave/common/importer/brave_importer_bridge.h"
 #include "brave/common/importer/profile_import.mojom.h"
@@ -31,6 +32,13 @@ class BraveExternalProcessImporterBridge : public ExternalProcessImporterBridge,
                      const base::string16& decrypted_card_number,
                      const std::string& origin) override;
 
+  // ExternalProcessImporterBridge overrides. Unlike the upstream bridge these
+  // can be called once per batch
+  void SetHistoryItems(const std::vector<ImporterURLRow>& rows,
+                       importer::VisitSource visit_source) override;
+  void SetFavicons(
+      const favicon_base::FaviconUsageDataList& favicons) override;
+
  private:
   ~BraveExternalProcessImporterBridge() override;
 
@@ -51,6 +51,12 @@ using base::Time;
 
 namespace {
 
+// History rows and favicons are read and sent to the browser in batches of at
+// most this many items, so that memory use does not grow with the size of the
+// source profile.
+const size_t kHistoryBatchSize = 5000;
+const size_t kFaviconsBatchSize = 100;
+
 // Most of below code is copied from os_crypt_win.cc
 #if defined(OS_WIN)
 // Contains base64 random key encrypted with DPAPI.
@@ -176,7 +182,9 @@ bool PasswordFormToImportedPasswordForm(
 
 }  // namespace
 
-ChromeImporter::ChromeImporter() {
+ChromeImporter::ChromeImporter()
+    : history_batch_size_(kHistoryBatchSize),
+      favicons_batch_size_(kFaviconsBatchSize) {
 }
 
 ChromeImporter::~ChromeImporter() {
@@ -219,6 +227,12 @@ void ChromeImporter::StartImport(const importer::SourceProfile& source_profile,
   bridge_->NotifyEnded();
 }
 
+void ChromeImporter::SetBatchSizesForTesting(size_t history_batch_size,
+                                             size_t favicons_batch_size) {
+  history_batch_size_ = history_batch_size;
+  favicons_batch_size_ = favicons_batch_size;
+}
+
 void ChromeImporter::ImportHistory() {
   base::FilePath history_path = source_path_.Append(
       base::FilePath::StringType(FILE_PATH_LITERAL("History")));
@@ -250,6 +264,7 @@ void ChromeImporter::ImportHistory() {
   s.BindInt64(4, ui::PAGE_TRANSITION_KEYWORD_GENERATED);
 
   std::vector<ImporterURLRow> rows;
+  rows.reserve(history_batch_size_);
   while (s.Step() && !cancelled()) {
     GURL url(s.ColumnString(0));
 
@@ -262,6 +277,11 @@ void ChromeImporter::ImportHistory() {
     row.visit_count = s.ColumnInt(4);
 
     rows.push_back(row);
+
+    if (rows.size() == history_batch_size_) {
+      bridge_->SetHistoryItems(rows, importer::VISIT_SOURCE_CHROME_IMPORTED);
+      rows.clear();
+    }
   }
 
   if (!rows.empty() && !cancelled())
@@ -333,11 +353,8 @@ void ChromeImporter::ImportBookmarks() {
   FaviconMap favicon_map;
   ImportFaviconURLs(&db, &favicon_map);
   // Write favicons into profile.
-  if (!favicon_map.empty() && !cancelled()) {
-    favicon_base::FaviconUsageDataList favicons;
-    LoadFaviconData(&db, favicon_map, &favicons);
-    bridge_->SetFavicons(favicons);
-  }
+  if (!favicon_map.empty() && !cancelled())
+    ImportFaviconData(&db, favicon_map);
 }
 
 void ChromeImporter::ImportFaviconURLs(
@@ -353,10 +370,9 @@ void ChromeImporter::ImportFaviconURLs(
   }
 }
 
-void ChromeImporter::LoadFaviconData(
+void ChromeImporter::ImportFaviconData(
     sql::Database* db,
-    const FaviconMap& favicon_map,
-    favicon_base::FaviconUsageDataList* favicons) {
+    const FaviconMap& favicon_map) {
   const char query[] = "SELECT f.url, fb.image_data "
                        "FROM favicons f "
                        "JOIN favicon_bitmaps fb "
@@ -367,8 +383,9 @@ void ChromeImporter::LoadFaviconData(
   if (!s.is_valid())
     return;
 
+  favicon_base::FaviconUsageDataList favicons;
   for (FaviconMap::const_iterator i = favicon_map.begin();
-       i != favicon_map.end(); ++i) {
+       i != favicon_map.end() && !cancelled(); ++i) {
     s.BindInt64(0, i->first);
     if (s.Step()) {
       favicon_base::FaviconUsageData usage;
@@ -386,10 +403,18 @@ void ChromeImporter::LoadFaviconData(
         continue;  // Unable to decode.
 
       usage.urls = i->second;
-      favicons->push_back(usage);
+      favicons.push_back(usage);
+
+      if (favicons.size() == favicons_batch_size_) {
+        bridge_->SetFavicons(favicons);
+        favicons.clear();
+      }
     }
     s.Reset(true);
   }
+
+  if (!favicons.empty() && !cancelled())
+    bridge_->SetFavicons(favicons);
 }
 
 void ChromeImporter::RecursiveReadBookmarksFolder(
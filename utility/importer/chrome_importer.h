@@ -6,6 +6,7 @@
 #ifndef BRAVE_UTILITY_IMPORTER_CHROME_IMPORTER_H_
 #define BRAVE_UTILITY_IMPORTER_CHROME_IMPORTER_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <map>
@@ -39,6 +40,11 @@ class ChromeImporter : public Importer {
                    uint16_t items,
                    ImporterBridge* bridge) override;
 
+  // Overrides how many history rows and favicons are sent to the bridge at a
+  // time.
+  void SetBatchSizesForTesting(size_t history_batch_size,
+                               size_t favicons_batch_size);
+
  protected:
   ~ChromeImporter() override;
 
@@ -62,10 +68,10 @@ class ChromeImporter : public Importer {
     sql::Database* db,
     FaviconMap* favicon_map);
 
-  // Loads and reencodes the individual favicons.
-  void LoadFaviconData(sql::Database* db,
-                       const FaviconMap& favicon_map,
-                       favicon_base::FaviconUsageDataList* favicons);
+  // Loads and reencodes the individual favicons, and sends them to the bridge
+  // in batches.
+  void ImportFaviconData(sql::Database* db,
+                         const FaviconMap& favicon_map);
 
   void RecursiveReadBookmarksFolder(
     const base::DictionaryValue* folder,
@@ -73,6 +79,9 @@ class ChromeImporter : public Importer {
     bool is_in_toolbar,
     std::vector<ImportedBookmarkEntry>* bookmarks);
 
+  size_t history_batch_size_;
+  size_t favicons_batch_size_;
+
   DISALLOW_COPY_AND_ASSIGN(ChromeImporter);
 };
 
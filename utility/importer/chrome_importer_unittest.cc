@@ -20,6 +20,7 @@
 #include "chrome/common/importer/mock_importer_bridge.h"
 #include "components/favicon_base/favicon_usage_data.h"
 #include "components/os_crypt/os_crypt_mocker.h"
+#include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 using base::ASCIIToUTF16;
@@ -87,6 +88,49 @@ TEST_F(ChromeImporterTest, ImportHistory) {
   EXPECT_EQ("https://www.nytimes.com/", history[2].url.spec());
 }
 
+TEST_F(ChromeImporterTest, ImportHistoryInBatches) {
+  std::vector<ImporterURLRow> first_batch;
+  std::vector<ImporterURLRow> second_batch;
+
+  EXPECT_CALL(*bridge_, NotifyStarted());
+  EXPECT_CALL(*bridge_, NotifyItemStarted(importer::HISTORY));
+  EXPECT_CALL(*bridge_, SetHistoryItems(_, _))
+      .WillOnce(::testing::SaveArg<0>(&first_batch))
+      .WillOnce(::testing::SaveArg<0>(&second_batch));
+  EXPECT_CALL(*bridge_, NotifyItemEnded(importer::HISTORY));
+  EXPECT_CALL(*bridge_, NotifyEnded());
+
+  // 3 rows in batches of 2 are sent in 2 calls.
+  importer_->SetBatchSizesForTesting(2, 1);
+  importer_->StartImport(profile_, importer::HISTORY, bridge_.get());
+
+  ASSERT_EQ(2u, first_batch.size());
+  EXPECT_EQ("https://brave.com/", first_batch[0].url.spec());
+  EXPECT_EQ("https://github.com/brave", first_batch[1].url.spec());
+  ASSERT_EQ(1u, second_batch.size());
+  EXPECT_EQ("https://www.nytimes.com/", second_batch[0].url.spec());
+}
+
+TEST_F(ChromeImporterTest, CancelImportHistoryBetweenBatches) {
+  std::vector<ImporterURLRow> history;
+
+  EXPECT_CALL(*bridge_, NotifyStarted());
+  EXPECT_CALL(*bridge_, NotifyItemStarted(importer::HISTORY));
+  EXPECT_CALL(*bridge_, SetHistoryItems(_, _))
+      .WillOnce(::testing::DoAll(
+          ::testing::SaveArg<0>(&history),
+          ::testing::InvokeWithoutArgs([this]() { importer_->Cancel(); })));
+  EXPECT_CALL(*bridge_, NotifyItemEnded(importer::HISTORY));
+  EXPECT_CALL(*bridge_, NotifyEnded());
+
+  importer_->SetBatchSizesForTesting(1, 1);
+  importer_->StartImport(profile_, importer::HISTORY | importer::FAVORITES,
+                         bridge_.get());
+
+  ASSERT_EQ(1u, history.size());
+  EXPECT_EQ("https://brave.com/", history[0].url.spec());
+}
+
 TEST_F(ChromeImporterTest, ImportBookmarks) {
   std::vector<ImportedBookmarkEntry> bookmarks;
 
@@ -137,6 +181,20 @@ TEST_F(ChromeImporterTest, ImportFavicons) {
             favicons[3].favicon_url.spec());
 }
 
+TEST_F(ChromeImporterTest, ImportFaviconsInBatches) {
+  EXPECT_CALL(*bridge_, NotifyStarted());
+  EXPECT_CALL(*bridge_, NotifyItemStarted(importer::FAVORITES));
+  EXPECT_CALL(*bridge_, AddBookmarks(_, _));
+  // 4 favicons in batches of 3 are sent in 2 calls.
+  EXPECT_CALL(*bridge_, SetFavicons(::testing::SizeIs(3)));
+  EXPECT_CALL(*bridge_, SetFavicons(::testing::SizeIs(1)));
+  EXPECT_CALL(*bridge_, NotifyItemEnded(importer::FAVORITES));
+  EXPECT_CALL(*bridge_, NotifyEnded());
+
+  importer_->SetBatchSizesForTesting(1, 3);
+  importer_->StartImport(profile_, importer::FAVORITES, bridge_.get());
+}
+
 // The mock keychain only works on macOS, so only run this test on macOS (for
 // now)
 #if defined(OS_MAC)